@@ -0,0 +1,139 @@
+/**
+ * @file board_bench.cpp
+ * @brief A microbenchmark timing GameManager::run() and GameState::step() on a large generated board.
+ * The maximal number of columns in a comment-line in this file is 106.
+ *
+ * Usage: board_bench [rows] [columns] [tanks per player] [max steps] [seed]
+ * The tanks are driven by a scripted algorithm that never asks for battle info, so the measured time is
+ * spent almost entirely inside the engine (Board, GameManager and BaseSatelliteView). The same script is
+ * then replayed through GameState::step() from a clone of the loaded game, which must end the same way,
+ * and random lookahead rollouts of the clone measure the simulated tank-steps per second.
+ */
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "board_generator.h"
+#include "gamemanager.h"
+#include "MyPlayerFactory.h"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+static const ActionRequest script[] = {
+    ActionRequest::MoveForward, ActionRequest::Shoot, ActionRequest::RotateRight45,
+    ActionRequest::MoveForward, ActionRequest::MoveForward, ActionRequest::RotateLeft90,
+    ActionRequest::Shoot, ActionRequest::MoveBackward, ActionRequest::DoNothing
+};
+static const size_t script_length = sizeof(script) / sizeof(script[0]);
+
+/** A tank algorithm cycling through a fixed script of moves, rotations and shots. */
+class ScriptedTankAlgorithm : public TankAlgorithm {
+    private:
+        size_t step_;
+
+    public:
+        ScriptedTankAlgorithm(int tank_index) : step_(tank_index) {}
+
+        ActionRequest getAction() override {
+            return script[step_++ % script_length];
+        }
+
+        void updateBattleInfo(BattleInfo& info) override { (void)info; }
+};
+
+class ScriptedTankAlgorithmFactory : public TankAlgorithmFactory {
+    public:
+        unique_ptr<TankAlgorithm> create(int player_index, int tank_index) const override {
+            (void)player_index;
+            return make_unique<ScriptedTankAlgorithm>(tank_index);
+        }
+};
+
+/** Replays the tanks' script through GameState::step() until the game is over, just as GameManager::run()
+ * asks every alive tank for its next action. Returns the winner. */
+static int replayScript(GameState state) {
+    vector<size_t> steps(state.getBoard().getNumTanks());
+    vector<ActionRequest> actions(steps.size());
+    for (size_t tankInd = 0; tankInd < steps.size(); ++tankInd) { steps[tankInd] = tankInd; }
+    do {
+        for (size_t tankInd = 0; tankInd < steps.size(); ++tankInd) {
+            if (state.getBoard().isTankAlive(tankInd)) {
+                actions[tankInd] = script[steps[tankInd]++ % script_length];
+            }
+        }
+    } while (!state.step(actions));
+    return state.getWinner();
+}
+
+/** Plays random rollouts of the given depth from copies of the given state for about a second. Returns
+ * the number of simulated tank-steps (alive tanks times steps) per second. */
+static double rolloutRate(const GameState& state, int depth, unsigned seed) {
+    mt19937 rng(seed);
+    uniform_int_distribution<int> action_dist(0, static_cast<int>(ActionRequest::DoNothing));
+    vector<ActionRequest> actions(state.getBoard().getNumTanks());
+    long long tank_steps = 0;
+    auto start = chrono::steady_clock::now();
+    chrono::duration<double> elapsed(0);
+    /* Assigning the state to the same rollout every time reuses its board's buffers. */
+    GameState rollout;
+    while (elapsed.count() < 1.0) {
+        rollout = state;
+        for (int step = 0; step < depth && !rollout.gameOver(); ++step) {
+            for (ActionRequest& action : actions) { action = static_cast<ActionRequest>(action_dist(rng)); }
+            tank_steps += rollout.getBoard().getPlayerATanks() + rollout.getBoard().getPlayerBTanks();
+            rollout.step(actions);
+        }
+        elapsed = chrono::steady_clock::now() - start;
+    }
+    return tank_steps / elapsed.count();
+}
+
+int main(int argc, char* argv[]) {
+    int rows = argc > 1 ? stoi(argv[1]) : 500;
+    int cols = argc > 2 ? stoi(argv[2]) : 500;
+    int tanks = argc > 3 ? stoi(argv[3]) : 16;
+    int max_steps = argc > 4 ? stoi(argv[4]) : 100;
+    unsigned seed = argc > 5 ? stoul(argv[5]) : 1;
+
+    fs::path work_dir = fs::temp_directory_path() / "tanks_board_bench";
+    fs::create_directories(work_dir);
+    fs::current_path(work_dir);
+    fs::remove("output_bench.txt");
+    BoardSpec spec;
+    spec.rows = rows;
+    spec.columns = cols;
+    spec.tanksPerPlayer = tanks;
+    spec.maxSteps = max_steps;
+    spec.seed = seed;
+    writeBoardFile("input_bench.txt", spec);
+
+    /* The engine reports every round to the console, which is not what is being measured here. */
+    GameManager game(make_unique<MyPlayerFactory>(), make_unique<ScriptedTankAlgorithmFactory>());
+    game.setConsoleOutput(false);
+    auto start = chrono::steady_clock::now();
+    game.readBoard("input_bench.txt");
+    auto loaded = chrono::steady_clock::now();
+    GameState state = game.cloneState();
+    game.run();
+    auto done = chrono::steady_clock::now();
+    int replayed_winner = replayScript(state);
+    double rollout_rate = rolloutRate(state, 20, seed);
+
+    chrono::duration<double, milli> load_ms = loaded - start;
+    chrono::duration<double, milli> run_ms = done - loaded;
+    cout << "board " << rows << "x" << cols << ", " << tanks << " tanks per player, " << max_steps
+         << " max steps, seed " << seed << '\n'
+         << "readBoard: " << load_ms.count() << " ms\n"
+         << "run:       " << run_ms.count() << " ms\n"
+         << "step():    " << rollout_rate << " tank-steps/s in depth-20 random rollouts\n";
+    if (replayed_winner != game.getWinner()) {
+        cout << "step() replay ended with winner " << replayed_winner << " instead of " << game.getWinner()
+             << '\n';
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,45 @@
+/**
+ * @file board_gen.cpp
+ * @brief A tool writing seeded, generated boards to input files, as the benchmarks generate them.
+ * The maximal number of columns in a comment-line in this file is 106.
+ *
+ * Usage: board_gen {output file} [rows] [columns] [open|maze] [wall density] [mine density]
+ *                  [tanks per player] [max steps] [num shells] [seed]
+ * The omitted arguments keep BoardSpec's defaults, and the same arguments always write the same board,
+ * so a benchmark's board can be played by tanks_game, or recorded and looked at with replay.
+ */
+
+#include <iostream>
+#include <string>
+#include "board_generator.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 11) {
+        cout << "usage: board_gen {output file} [rows] [columns] [open|maze] [wall density] "
+             << "[mine density] [tanks per player] [max steps] [num shells] [seed]\n";
+        return 1;
+    }
+    try {
+        BoardSpec spec;
+        if (argc > 2) { spec.rows = stoi(argv[2]); }
+        if (argc > 3) { spec.columns = stoi(argv[3]); }
+        if (argc > 4) {
+            string layout = argv[4];
+            if (layout == "maze") { spec.layout = BoardSpec::MAZE; }
+            else if (layout != "open") { throw invalid_argument("The layout must be open or maze"); }
+        }
+        if (argc > 5) { spec.wallDensity = stod(argv[5]); }
+        if (argc > 6) { spec.mineDensity = stod(argv[6]); }
+        if (argc > 7) { spec.tanksPerPlayer = stoi(argv[7]); }
+        if (argc > 8) { spec.maxSteps = stoi(argv[8]); }
+        if (argc > 9) { spec.numShells = stoi(argv[9]); }
+        if (argc > 10) { spec.seed = stoul(argv[10]); }
+        writeBoardFile(argv[1], spec);
+    } catch (const exception& e) {
+        cerr << "Error: " << e.what() << endl;
+        return 1;
+    }
+    return 0;
+}
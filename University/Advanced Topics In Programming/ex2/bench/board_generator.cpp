@@ -0,0 +1,93 @@
+/**
+ * @file board_generator.cpp
+ * @brief A file detailing the implementation of all the functions declared in board_generator.h.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#include "board_generator.h"
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <utility>
+using namespace std;
+
+/** Carves a maze into the given all-wall rows: every cell at odd coordinates is a room, and a randomized
+ * depth-first search knocks down the wall between each room and an unvisited neighbor. */
+static void carveMaze(vector<string>& lines, mt19937& rng) {
+    int rows = lines.size();
+    int columns = lines[0].size();
+    vector<pair<int, int>> stack = {{1, 1}};
+    lines[1][1] = ' ';
+    const pair<int, int> steps[] = {{-2, 0}, {2, 0}, {0, -2}, {0, 2}};
+    while (!stack.empty()) {
+        pair<int, int> room = stack.back();
+        vector<pair<int, int>> unvisited;
+        for (const auto& step : steps) {
+            int row = room.first + step.first;
+            int col = room.second + step.second;
+            if (row > 0 && row < rows - 1 && col > 0 && col < columns - 1 && lines[row][col] == '#') {
+                unvisited.emplace_back(row, col);
+            }
+        }
+        if (unvisited.empty()) {
+            stack.pop_back();
+            continue;
+        }
+        pair<int, int> next = unvisited[uniform_int_distribution<size_t>(0, unvisited.size() - 1)(rng)];
+        lines[(room.first + next.first) / 2][(room.second + next.second) / 2] = ' ';
+        lines[next.first][next.second] = ' ';
+        stack.push_back(next);
+    }
+}
+
+vector<string> generateBoard(const BoardSpec& spec) {
+    if (spec.rows < 3 || spec.columns < 3) { throw invalid_argument("A board needs at least 3x3 cells"); }
+    mt19937 rng(spec.seed);
+    uniform_real_distribution<double> roll(0.0, 1.0);
+    vector<string> lines;
+    if (spec.layout == BoardSpec::MAZE) {
+        lines.assign(spec.rows, string(spec.columns, '#'));
+        carveMaze(lines, rng);
+        /* Knocking down some of the walls between corridors opens loops, so paths are not unique. */
+        for (int row = 1; row < spec.rows - 1; ++row) {
+            for (int col = 1; col < spec.columns - 1; ++col) {
+                if (lines[row][col] == '#' && roll(rng) < spec.wallDensity) { lines[row][col] = ' '; }
+            }
+        }
+    } else {
+        lines.assign(spec.rows, string(spec.columns, ' '));
+        for (string& line : lines) {
+            for (char& c : line) {
+                if (roll(rng) < spec.wallDensity) { c = '#'; }
+            }
+        }
+    }
+
+    vector<pair<int, int>> free_cells;
+    for (int row = 0; row < spec.rows; ++row) {
+        for (int col = 0; col < spec.columns; ++col) {
+            if (lines[row][col] == ' ') { free_cells.emplace_back(row, col); }
+        }
+    }
+    if (free_cells.size() < 2 * static_cast<size_t>(spec.tanksPerPlayer)) {
+        throw invalid_argument("Too few free cells for the tanks");
+    }
+    /* The tanks get the first free cells of a shuffle, and the mines are rolled on the rest. */
+    shuffle(free_cells.begin(), free_cells.end(), rng);
+    for (size_t i = 0; i < free_cells.size(); ++i) {
+        char& c = lines[free_cells[i].first][free_cells[i].second];
+        if (i < 2 * static_cast<size_t>(spec.tanksPerPlayer)) { c = (i % 2 == 0) ? '1' : '2'; }
+        else if (roll(rng) < spec.mineDensity) { c = '@'; }
+    }
+    return lines;
+}
+
+void writeBoardFile(const string& file_name, const BoardSpec& spec) {
+    ofstream out(file_name);
+    if (!out.is_open()) { throw runtime_error("Failed to open board file: " + file_name); }
+    out << "Generated board, seed " << spec.seed << '\n' << "MaxSteps=" << spec.maxSteps << '\n'
+        << "NumShells=" << spec.numShells << '\n' << "Rows=" << spec.rows << '\n'
+        << "Cols=" << spec.columns << '\n';
+    for (const string& line : generateBoard(spec)) { out << line << '\n'; }
+}
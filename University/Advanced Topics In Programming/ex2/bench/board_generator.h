@@ -0,0 +1,35 @@
+/**
+ * @file board_generator.h
+ * @brief A file depicting the seeded board generator shared by the benchmarks.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#pragma once
+#include <string>
+#include <vector>
+
+/** What a generated board looks like. The same spec (seed included) always generates the same board. */
+struct BoardSpec {
+    /** How the walls are laid out: scattered at random with the given density, or as a maze of one-cell
+     * corridors (with the given density of its walls knocked down again, to open loops in it). */
+    enum Layout { OPEN_FIELD, MAZE };
+
+    int rows = 100;
+    int columns = 100;
+    Layout layout = OPEN_FIELD;
+    double wallDensity = 0.10;
+    double mineDensity = 0.02;      /* Of the cells left free by the walls. */
+    int tanksPerPlayer = 4;
+    int maxSteps = 1000;
+    int numShells = 16;
+    unsigned seed = 1;
+};
+
+/** Generates the rows of the board described by the given spec, as they appear in an input file: '#'
+ * walls, '@' mines, '1' and '2' tanks, and ' ' empty cells. The tanks are put on free cells, so the spec
+ * must leave enough of them. */
+std::vector<std::string> generateBoard(const BoardSpec& spec);
+
+/** Writes the board described by the given spec to an input file with the given name, ready for
+ * GameManager::readBoard(). */
+void writeBoardFile(const std::string& file_name, const BoardSpec& spec);
@@ -0,0 +1,495 @@
+/**
+ * @file engine_check.cpp
+ * @brief A tool checking, on seeded generated boards, the guarantees the engine's fast paths make.
+ * The maximal number of columns in a comment-line in this file is 106.
+ *
+ * Usage: engine_check [seeds]
+ * For each seed (1 to 8 by default):
+ *  - the distances and paths of a DistanceField are checked against BFS::runBFS() from the same cells to
+ *    every one of its sources, on an open field and on a maze;
+ *  - a shell storm is played by random actions both serially and with its shells updated in tiles on a
+ *    thread pool (see Board::setThreadPool()), and the two states are checked to be equal every turn;
+ *  - the incrementally kept state hash of both (see Board::hashState()) is checked every turn against the
+ *    hash of a clone of the board, which computes it from scratch;
+ *  - the lines of sight of a SightTable are checked against the cell-by-cell walk
+ *    BaseTankAlgorithm::hasLineOfSight() falls back on without one, on an open field, on a maze and on a
+ *    field sparse enough to see across;
+ *  - the cells BaseTankAlgorithm::isSafe() finds safe through a ThreatMap are checked against the ones it
+ *    finds safe by scanning the two cells in every direction without one, on boards strewn with shells;
+ *  - a game is played by random actions, and after every turn each alive tank's path (see
+ *    BaseTankAlgorithm::findPath()), whether cached or not, is checked against a fresh search: read off a
+ *    fresh distance field as its player would hand it one, and by a fresh BFS toward an enemy without it.
+ *    Mines and shells are dropped on the tanks' cached paths along the way, besides the walls the shells
+ *    wreck and the tanks (their targets included) that move.
+ * Prints the first mismatch found and returns 1, or returns 0 if everything matched. Run by make check.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "board_generator.h"
+#include "bfs.h"
+#include "distance_field.h"
+#include "neighbor_table.h"
+#include "sight_table.h"
+#include "threat_map.h"
+#include "BaseBattleInfo.h"
+#include "BasePlayer.h"
+#include "BaseSatelliteView.h"
+#include "BaseTankAlgorithm.h"
+#include "gamemanager.h"
+#include "MyPlayerFactory.h"
+#include "MyTankAlgorithmFactory.h"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+/** Prints the given mismatch of the given check, and returns false, so that checks can fail with it. */
+static bool mismatch(const string& check, unsigned seed, const string& what) {
+    cout << "FAILED: " << check << " (seed " << seed << "): " << what << '\n';
+    return false;
+}
+
+/** Formats the given (X, Y) coordinates for a mismatch. */
+static string posString(pair<int, int> pos) {
+    return "(" + to_string(pos.first) + ", " + to_string(pos.second) + ")";
+}
+
+/** A tank algorithm that never acts, through which the checks reach BaseTankAlgorithm's own queries, with
+ * or without the tables its player would otherwise hand it. */
+class CheckTankAlgorithm : public BaseTankAlgorithm {
+    public:
+        CheckTankAlgorithm(int player_index, int tank_index)
+            : BaseTankAlgorithm(player_index, tank_index) {}
+
+        ActionRequest getAction() override { return ActionRequest::DoNothing; }
+
+        void setSightTable(shared_ptr<const SightTable> sight_table) {
+            sightTable_ = std::move(sight_table);
+        }
+
+        void setThreatMap(shared_ptr<const ThreatMap> threat_map) { threatMap_ = std::move(threat_map); }
+};
+
+/** Generates the given board as the grid its players see. */
+static vector<vector<char>> generateGrid(const BoardSpec& spec) {
+    vector<vector<char>> grid;
+    for (const string& line : generateBoard(spec)) { grid.emplace_back(line.begin(), line.end()); }
+    return grid;
+}
+
+/* ------------------------------------- DISTANCE FIELDS VS BFS: ------------------------------------- */
+
+/** Checks the distance field of the given board from a few random free cells against a BFS from random
+ * cells to each of those sources: the field's distance must be the shortest of the BFS paths, and the
+ * path it leads along must be that long, step between neighbors only, and end at a source. */
+static bool checkDistanceField(const BoardSpec& spec, int num_sources, int num_cells) {
+    const string check = "distance field vs BFS";
+    vector<string> lines = generateBoard(spec);
+    vector<vector<char>> grid;
+    vector<pair<int, int>> free_cells;
+    for (int row = 0; row < spec.rows; ++row) {
+        grid.emplace_back(lines[row].begin(), lines[row].end());
+        for (int col = 0; col < spec.columns; ++col) {
+            if (lines[row][col] != '#' && lines[row][col] != '@') { free_cells.emplace_back(row, col); }
+        }
+    }
+    mt19937 rng(spec.seed);
+    uniform_int_distribution<size_t> pick(0, free_cells.size() - 1);
+    vector<pair<int, int>> sources;
+    for (int i = 0; i < num_sources; ++i) { sources.push_back(free_cells[pick(rng)]); }
+
+    shared_ptr<const NeighborTable> neighbors = NeighborTable::getShared(spec.rows, spec.columns);
+    DistanceField field(grid, sources, *neighbors);
+    BFS bfs(spec.rows, spec.columns);
+    for (int i = 0; i < num_cells; ++i) {
+        pair<int, int> cell = free_cells[pick(rng)];
+        int expected = -1;
+        for (pair<int, int> source : sources) {
+            /* A BFS from a cell to itself finds no path, as a tank on its target has nowhere to go. */
+            int dis = 0;
+            if (cell != source) {
+                bfs.runBFS(cell, source, grid);
+                if (!bfs.pathExists()) { continue; }
+                dis = bfs.getBFSPath().size() - 1;
+            }
+            if (expected < 0 || dis < expected) { expected = dis; }
+        }
+        int dis = field.getDis(cell);
+        if (dis != expected) {
+            return mismatch(check, spec.seed, "the distance from " + posString(cell) + " is " +
+                to_string(dis) + " rather than " + to_string(expected));
+        }
+        vector<pair<int, int>> path = field.pathFrom(cell);
+        if (dis < 0) {
+            if (!path.empty()) { return mismatch(check, spec.seed, "a path from " + posString(cell)); }
+            continue;
+        }
+        if (static_cast<int>(path.size()) != dis + 1 || path.front() != cell) {
+            return mismatch(check, spec.seed, "the path from " + posString(cell) + " has " +
+                to_string(path.size()) + " cells for a distance of " + to_string(dis));
+        }
+        for (size_t step = 1; step < path.size(); ++step) {
+            const int* next = neighbors->getNeighbors(path[step - 1].first * spec.columns +
+                path[step - 1].second);
+            pair<int, int> pos = path[step];
+            if (find(next, next + 8, pos.first * spec.columns + pos.second) == next + 8 ||
+                grid[pos.first][pos.second] == '#' || grid[pos.first][pos.second] == '@') {
+                return mismatch(check, spec.seed, "the path from " + posString(cell) + " steps onto " +
+                    posString(pos));
+            }
+        }
+        if (find(sources.begin(), sources.end(), path.back()) == sources.end()) {
+            return mismatch(check, spec.seed, "the path from " + posString(cell) +
+                " ends off the sources");
+        }
+    }
+    return true;
+}
+
+/* ----------------------------------- TILES AND HASHES VS SERIAL: ----------------------------------- */
+
+/** Reads the given board through GameManager::readBoard(), as tanks_game does, into a game state. */
+static GameState loadState(const BoardSpec& spec) {
+    const string input_file = "input_engine_check.txt";
+    writeBoardFile(input_file, spec);
+    GameManager game(make_unique<MyPlayerFactory>(), make_unique<MyTankAlgorithmFactory>());
+    game.setConsoleOutput(false);
+    game.readBoard(input_file);
+    fs::remove(input_file);
+    return game.cloneState();
+}
+
+/** Checks the given board's incrementally kept state hash against the one a clone computes from
+ * scratch. */
+static bool checkHash(Board& board, unsigned seed, const string& which, int turn) {
+    uint64_t hash = board.hashState();
+    if (hash != board.clone().hashState()) {
+        return mismatch("incremental hash vs rehash", seed, "the " + which +
+            " board's hash is off after " + to_string(turn) + " turns");
+    }
+    return true;
+}
+
+/** Plays a shell storm on the given board by random actions (mostly shots) both serially and with the
+ * shells updated in tiles on the given pool, whatever their number, and checks every turn that both
+ * states are equal and that both boards' hashes match their rehashed clones. */
+static bool checkTiles(const BoardSpec& spec, ThreadPool& pool, int turns) {
+    GameState serial = loadState(spec);
+    GameState tiled = serial;
+    tiled.getBoard().setThreadPool(&pool, 0);
+    mt19937 rng(spec.seed);
+    uniform_int_distribution<int> pick_action(0, 11);
+    for (int turn = 1; turn <= turns && !serial.gameOver(); ++turn) {
+        vector<ActionRequest> actions;
+        for (int i = 0; i < serial.getBoard().getNumTanks(); ++i) {
+            int action = pick_action(rng);
+            actions.push_back(action > static_cast<int>(ActionRequest::DoNothing) ? ActionRequest::Shoot
+                : static_cast<ActionRequest>(action));
+        }
+        serial.step(actions);
+        tiled.step(actions);
+        if (serial != tiled) {
+            return mismatch("tiled shells vs serial", spec.seed, "the states differ after " +
+                to_string(turn) + " turns");
+        }
+        if (!checkHash(serial.getBoard(), spec.seed, "serial", turn) ||
+            !checkHash(tiled.getBoard(), spec.seed, "tiled", turn)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* ------------------------------------- SIGHT TABLES VS WALKS: -------------------------------------- */
+
+/** Checks a tank's lines of sight through a SightTable of the given board against the ones it walks cell
+ * by cell without it, from random cells in random directions: to random targets for a quarter of the
+ * queries, to targets on the walked line for half of them, and to targets on it right around the farthest
+ * the walk goes (max(rows, columns) steps) for the last quarter. */
+static bool checkSightTable(const BoardSpec& spec, int num_queries) {
+    const string check = "sight table vs walk";
+    vector<vector<char>> grid = generateGrid(spec);
+    CheckTankAlgorithm walker(1, 0);
+    walker.setGrid(grid);
+    CheckTankAlgorithm looker(1, 0);
+    looker.setGrid(grid);
+    looker.setSightTable(make_shared<const SightTable>(grid));
+    mt19937 rng(spec.seed);
+    uniform_int_distribution<int> pick_row(0, spec.rows - 1);
+    uniform_int_distribution<int> pick_column(0, spec.columns - 1);
+    uniform_int_distribution<int> pick_dir(0, 7);
+    int max_steps = max(spec.rows, spec.columns);
+    uniform_int_distribution<int> pick_steps(1, max_steps + 2);
+    uniform_int_distribution<int> pick_far_steps(max_steps - 1, max_steps + 1);
+    int in_sight = 0;
+    for (int i = 0; i < num_queries; ++i) {
+        pair<int, int> pos(pick_row(rng), pick_column(rng));
+        Direction dir = indexToDirection(pick_dir(rng));
+        pair<int, int> target(pick_row(rng), pick_column(rng));
+        if (i % 4 != 0) {
+            target = pos;
+            for (int steps = i % 4 == 3 ? pick_far_steps(rng) : pick_steps(rng); steps > 0; --steps) {
+                target = getNextCoordsInDir(dir, target, spec.rows, spec.columns);
+            }
+        }
+        bool walked = walker.hasLineOfSight(pos, dir, target);
+        if (looker.hasLineOfSight(pos, dir, target) != walked) {
+            return mismatch(check, spec.seed, "the table says " + posString(target) +
+                (walked ? " is not" : " is") + " in sight from " + posString(pos) + " in direction " +
+                to_string(directionToIndex(dir)));
+        }
+        in_sight += walked;
+    }
+    if (in_sight == 0 || in_sight == num_queries) {
+        return mismatch(check, spec.seed, "every query had the same answer, so nothing was compared");
+    }
+    return true;
+}
+
+/* -------------------------------------- THREAT MAPS VS SCANS: -------------------------------------- */
+
+/** Checks every cell of the given board, strewn with shells ('*') on the given share of its free cells,
+ * as a tank finds it safe or not through a ThreatMap of the board against as it finds it by scanning the
+ * cells around it without one. */
+static bool checkThreatMap(const BoardSpec& spec, double shell_density) {
+    const string check = "threat map vs scan";
+    vector<vector<char>> grid = generateGrid(spec);
+    mt19937 rng(spec.seed);
+    bernoulli_distribution place_shell(shell_density);
+    for (vector<char>& row : grid) {
+        for (char& cell : row) {
+            if (cell == ' ' && place_shell(rng)) { cell = '*'; }
+        }
+    }
+    CheckTankAlgorithm scanner(1, 0);
+    scanner.setGrid(grid);
+    CheckTankAlgorithm looker(1, 0);
+    looker.setGrid(grid);
+    looker.setThreatMap(make_shared<const ThreatMap>(grid));
+    int safe = 0;
+    for (int row = 0; row < spec.rows; ++row) {
+        for (int col = 0; col < spec.columns; ++col) {
+            bool scanned = scanner.isSafe({row, col});
+            if (looker.isSafe({row, col}) != scanned) {
+                return mismatch(check, spec.seed, "the map finds " + posString({row, col}) +
+                    (scanned ? " unsafe" : " safe"));
+            }
+            safe += scanned;
+        }
+    }
+    if (safe == 0 || safe == spec.rows * spec.columns) {
+        return mismatch(check, spec.seed, "every cell had the same answer, so nothing was compared");
+    }
+    return true;
+}
+
+/* --------------------------------- CACHED PATHS VS FRESH SEARCHES: --------------------------------- */
+
+/** What the path cache check went through, summed over its games, so that it can tell whether it
+ * exercised every way a cached path goes stale. */
+struct PathCacheCounts {
+    unsigned long hits = 0;
+    unsigned long misses = 0;
+    int wreckedWalls = 0;
+    int minesOnPaths = 0;
+    int shellsOnPaths = 0;
+    int movedTargets = 0;
+};
+
+/** Gets the positions of the tanks of every player but the given one on the given grid, in the order
+ * BasePlayer finds them in. */
+static vector<pair<int, int>> enemiesOf(int player_index, const vector<vector<char>>& grid) {
+    vector<pair<int, int>> enemies;
+    for (size_t row = 0; row < grid.size(); ++row) {
+        for (size_t col = 0; col < grid[row].size(); ++col) {
+            if (isdigit(grid[row][col]) && grid[row][col] - '0' != player_index) {
+                enemies.emplace_back(row, col);
+            }
+        }
+    }
+    return enemies;
+}
+
+/** Plays the given board by random actions, syncing a satellite view with it after every turn as
+ * GameManager does (re-reading only the cells that changed). Every alive tank then finds its path twice:
+ * once through the distance field its player hands it, and once toward an enemy by a BFS of its own, as
+ * it would without the field. Both must equal a fresh search on the same grid, whether they came from the
+ * tank's cache or not. Every other turn, a mine or a shell is dropped on an empty cell of some tank's
+ * cached path. */
+static bool checkPathCache(const BoardSpec& spec, int turns, PathCacheCounts& counts) {
+    const string check = "cached path vs fresh search";
+    GameState state = loadState(spec);
+    Board& board = state.getBoard();
+    int rows = board.getRows();
+    int columns = board.getColumns();
+    vector<Cell> cells = board.getCells();
+    BaseSatelliteView view;
+    view.initializeGrid(rows, columns);
+    view.updateGrid(cells);
+    BasePlayer players[2] = {BasePlayer(1, rows, columns, spec.maxSteps, spec.numShells),
+        BasePlayer(2, rows, columns, spec.maxSteps, spec.numShells)};
+    vector<int> player_indices;
+    vector<CheckTankAlgorithm> field_tanks;
+    vector<CheckTankAlgorithm> bfs_tanks;
+    vector<pair<int, int>> targets;
+    vector<vector<pair<int, int>>> paths(board.getNumTanks());
+    for (int i = 0; i < board.getNumTanks(); ++i) {
+        pair<int, int> pos = board.getPosTank(i);
+        view.addPosition(pos.first, pos.second);
+        player_indices.push_back(view.getGrid()[pos.first][pos.second] - '0');
+        field_tanks.emplace_back(player_indices.back(), i);
+        bfs_tanks.emplace_back(player_indices.back(), i);
+        targets.emplace_back(-1, -1);
+    }
+
+    mt19937 rng(spec.seed);
+    uniform_int_distribution<int> pick_action(0, 11);
+    uniform_int_distribution<int> pick_tank(0, board.getNumTanks() - 1);
+    uniform_int_distribution<int> pick_dir(0, 7);
+    BFS fresh_bfs(rows, columns);
+    for (int turn = 1; turn <= turns && !state.gameOver(); ++turn) {
+        vector<ActionRequest> actions;
+        for (int i = 0; i < board.getNumTanks(); ++i) {
+            int action = pick_action(rng);
+            actions.push_back(action > static_cast<int>(ActionRequest::DoNothing) ? ActionRequest::Shoot
+                : static_cast<ActionRequest>(action));
+        }
+        state.step(actions);
+
+        /* Stale some tank's cached path on purpose, with a mine or a shell on an empty cell along it. */
+        int tank_ind = pick_tank(rng);
+        const vector<pair<int, int>>& cached_path = paths[tank_ind];
+        if (turn % 2 == 0 && board.isTankAlive(tank_ind) && cached_path.size() > 2) {
+            pair<int, int> pos = cached_path[cached_path.size() / 2];
+            if (view.getGrid()[pos.first][pos.second] == ' ' && board.getCell(pos) == Cell()) {
+                if (turn % 4 == 0) {
+                    board.placeMine(pos);
+                    counts.minesOnPaths++;
+                } else {
+                    board.addNewShell(pos.first, pos.second, indexToDirection(pick_dir(rng)));
+                    counts.shellsOnPaths++;
+                }
+            }
+        }
+
+        /* Sync the view as GameManager::syncSatelliteView() does, from the cells that changed. */
+        const vector<Cell>& new_cells = board.getCells();
+        vector<int> changed;
+        for (size_t index = 0; index < cells.size(); ++index) {
+            if (new_cells[index] == cells[index]) { continue; }
+            changed.push_back(index);
+            counts.wreckedWalls += cellToChar(cells[index]) == '#' && cellToChar(new_cells[index]) != '#';
+        }
+        view.updateCells(new_cells, changed);
+        cells = new_cells;
+        for (int i = 0; i < board.getNumTanks(); ++i) {
+            pair<int, int> pos = board.getPosTank(i);
+            view.setPosition(i, pos.first, pos.second);
+        }
+
+        for (int i = 0; i < board.getNumTanks(); ++i) {
+            if (!board.isTankAlive(i)) { continue; }
+            view.setCurrTankInd(i);
+            const vector<vector<char>>& grid = *view.getSnapshot();
+            pair<int, int> pos = view.getCurrTankPos();
+            players[player_indices[i] - 1].updateTankWithBattleInfo(field_tanks[i], view);
+            DistanceField fresh_field(grid, enemiesOf(player_indices[i], grid));
+            paths[i] = field_tanks[i].findPath({-1, -1});
+            if (paths[i] != fresh_field.pathFrom(pos)) {
+                return mismatch(check, spec.seed, "tank " + to_string(i) + "'s path from " +
+                    posString(pos) + " differs from a fresh distance field's after " + to_string(turn) +
+                    " turns");
+            }
+
+            BaseBattleInfo info;
+            info.setGrid(view.getSnapshot());
+            info.setMyPos(pos);
+            info.setNumShells(spec.numShells);
+            info.setObstaclesVersion(view.getObstaclesVersion());
+            bfs_tanks[i].updateBattleInfo(info);
+            if (bfs_tanks[i].getEnemyPositions().empty()) { continue; }
+            pair<int, int> target = bfs_tanks[i].getEnemyPositions().front();
+            counts.movedTargets += targets[i] != pair<int, int>(-1, -1) && targets[i] != target;
+            targets[i] = target;
+            fresh_bfs.runBFS(pos, target, grid);
+            if (bfs_tanks[i].findPath(target) != fresh_bfs.getBFSPath()) {
+                return mismatch(check, spec.seed, "tank " + to_string(i) + "'s path from " +
+                    posString(pos) + " to " + posString(target) + " differs from a fresh BFS's after " +
+                    to_string(turn) + " turns");
+            }
+        }
+    }
+    for (int i = 0; i < board.getNumTanks(); ++i) {
+        counts.hits += field_tanks[i].getPathCacheHits() + bfs_tanks[i].getPathCacheHits();
+        counts.misses += field_tanks[i].getPathCacheMisses() + bfs_tanks[i].getPathCacheMisses();
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    unsigned seeds = argc > 1 ? stoul(argv[1]) : 8;
+    ThreadPool pool(4);
+    PathCacheCounts path_counts;
+    bool passed = true;
+    for (unsigned seed = 1; seed <= seeds && passed; ++seed) {
+        BoardSpec open_field;
+        open_field.rows = 60;
+        open_field.columns = 90;
+        open_field.wallDensity = 0.25;
+        open_field.mineDensity = 0.05;
+        open_field.seed = seed;
+        BoardSpec maze;
+        maze.rows = 41;
+        maze.columns = 61;
+        maze.layout = BoardSpec::MAZE;
+        maze.wallDensity = 0.05;
+        maze.seed = seed;
+        BoardSpec sparse;
+        sparse.rows = 30;
+        sparse.columns = 50;
+        sparse.wallDensity = 0.005;
+        sparse.seed = seed;
+        BoardSpec skirmish;
+        skirmish.rows = 30;
+        skirmish.columns = 40;
+        skirmish.wallDensity = 0.15;
+        skirmish.mineDensity = 0.02;
+        skirmish.tanksPerPlayer = 12;
+        skirmish.numShells = 20;
+        skirmish.seed = seed;
+        BoardSpec shell_storm;
+        shell_storm.rows = 48;
+        shell_storm.columns = 64;
+        shell_storm.wallDensity = 0.05;
+        shell_storm.mineDensity = 0.01;
+        shell_storm.tanksPerPlayer = 150;
+        shell_storm.numShells = 40;
+        shell_storm.seed = seed;
+        passed = checkDistanceField(open_field, 1, 100) && checkDistanceField(open_field, 6, 100) &&
+            checkDistanceField(maze, 3, 100) && checkTiles(shell_storm, pool, 60) &&
+            checkSightTable(open_field, 20000) && checkSightTable(maze, 20000) &&
+            checkSightTable(sparse, 20000) && checkThreatMap(open_field, 0.02) &&
+            checkThreatMap(maze, 0.05) && checkPathCache(skirmish, 80, path_counts);
+    }
+    if (!passed) { return 1; }
+    if (path_counts.hits == 0 || path_counts.misses == 0 || path_counts.wreckedWalls == 0 ||
+        path_counts.minesOnPaths == 0 || path_counts.shellsOnPaths == 0 ||
+        path_counts.movedTargets == 0) {
+        cout << "FAILED: cached path vs fresh search: the games did not go through every way a cached "
+             << "path goes stale, so the cache was not fully checked\n";
+        return 1;
+    }
+    cout << "engine_check: distance fields vs BFS, tiled shells vs serial, incremental hashes vs rehash, "
+         << "sight tables vs walks, threat maps vs scans and cached paths vs fresh searches agree on "
+         << seeds << " seeds\n"
+         << "engine_check: the paths were cached " << path_counts.hits << " times and searched "
+         << path_counts.misses << " times, through " << path_counts.wreckedWalls << " wrecked walls, "
+         << path_counts.minesOnPaths << " mines and " << path_counts.shellsOnPaths
+         << " shells dropped on paths, and " << path_counts.movedTargets << " moved targets\n";
+    return 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file search_bench.cpp
+ * @brief A microbenchmark timing the tank algorithms' searches and line-of-sight queries.
+ * The maximal number of columns in a comment-line in this file is 106.
+ *
+ * Usage: search_bench [rows] [columns] [seed]
+ * On a random grid with ~15% walls and ~2% mines, measures BFS::runBFS() between random cells, the
+ * DistanceField from 16 random sources (through a NeighborTable kept between them, as every player
+ * keeps one), and lines of sight both walked cell by cell (as
+ * BaseTankAlgorithm::hasLineOfSight() does without a SightTable) and looked up in a SightTable.
+ */
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "bfs.h"
+#include "distance_field.h"
+#include "sight_table.h"
+
+using namespace std;
+
+/** Runs the given function on 0, 1, 2, ... for about a second, and returns the number of runs per
+ * second. The sum of the results is printed alongside, so that the work cannot be optimized away. */
+static double rate(const string& name, const function<long long(long long)>& run) {
+    long long runs = 0;
+    long long checksum = 0;
+    auto start = chrono::steady_clock::now();
+    chrono::duration<double> elapsed(0);
+    while (elapsed.count() < 1.0) {
+        for (int batch = 0; batch < 64; ++batch) { checksum += run(runs++); }
+        elapsed = chrono::steady_clock::now() - start;
+    }
+    double per_second = runs / elapsed.count();
+    cout << name << per_second << " /s  (checksum " << checksum << ")\n";
+    return per_second;
+}
+
+/** Walks from the given cell in the given direction, as BaseTankAlgorithm::hasLineOfSight() does. */
+static bool walkLineOfSight(const vector<vector<char>>& grid, pair<int, int> pos, Direction dir,
+    pair<int, int> target_pos) {
+        int rows = grid.size();
+        int cols = grid[0].size();
+        int max_steps = max(rows, cols);
+        for (int step = 0; step < max_steps; ++step) {
+            pos = getNextCoordsInDir(dir, pos, rows, cols);
+            if (pos == target_pos) { return true; }
+            if (grid[pos.first][pos.second] == '#') { return false; }
+        }
+        return false;
+    }
+
+int main(int argc, char* argv[]) {
+    int rows = argc > 1 ? stoi(argv[1]) : 200;
+    int cols = argc > 2 ? stoi(argv[2]) : 200;
+    unsigned seed = argc > 3 ? stoul(argv[3]) : 1;
+
+    mt19937 rng(seed);
+    uniform_int_distribution<int> percent(0, 99);
+    vector<vector<char>> grid(rows, vector<char>(cols, ' '));
+    for (auto& line : grid) {
+        for (char& c : line) {
+            int roll = percent(rng);
+            if (roll < 15) { c = '#'; }
+            else if (roll < 17) { c = '@'; }
+        }
+    }
+    /* Random open cells, drawn up front so that drawing them is not timed. */
+    vector<pair<int, int>> cells;
+    uniform_int_distribution<int> row_dist(0, rows - 1);
+    uniform_int_distribution<int> col_dist(0, cols - 1);
+    while (cells.size() < 4096) {
+        pair<int, int> pos = {row_dist(rng), col_dist(rng)};
+        if (grid[pos.first][pos.second] == ' ') { cells.push_back(pos); }
+    }
+    auto cell = [&cells](long long i) { return cells[i % cells.size()]; };
+
+    cout << "grid " << rows << "x" << cols << ", seed " << seed << '\n';
+    BFS bfs;
+    rate("BFS::runBFS:                ", [&](long long i) {
+        bfs.runBFS(cell(i), cell(i + 1), grid);
+        return static_cast<long long>(bfs.getBFSPath().size());
+    });
+    NeighborTable neighbors(rows, cols);
+    rate("DistanceField (16 sources): ", [&](long long i) {
+        vector<pair<int, int>> sources(16);
+        for (int s = 0; s < 16; ++s) { sources[s] = cell(i + s); }
+        DistanceField field(grid, sources, neighbors);
+        return static_cast<long long>(field.getDis(cell(i + 16)));
+    });
+    double walked = rate("line of sight, walked:      ", [&](long long i) {
+        return static_cast<long long>(walkLineOfSight(grid, cell(i), indexToDirection(i & 7), cell(i + 1)));
+    });
+    SightTable sight_table;
+    rate("SightTable construction:    ", [&](long long i) {
+        sight_table = SightTable(grid);
+        return static_cast<long long>(sight_table.getWallDis(cell(i), Direction::U));
+    });
+    double looked_up = rate("line of sight, SightTable:  ", [&](long long i) {
+        return static_cast<long long>(sight_table.hasLineOfSight(cell(i), indexToDirection(i & 7), cell(i + 1)));
+    });
+    cout << "SightTable speedup: " << looked_up / walked << "x\n";
+    return 0;
+}
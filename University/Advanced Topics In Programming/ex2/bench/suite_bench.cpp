@@ -0,0 +1,227 @@
+/**
+ * @file suite_bench.cpp
+ * @brief A benchmark suite playing fixed, seeded scenarios through GameManager::run().
+ * The maximal number of columns in a comment-line in this file is 106.
+ *
+ * Usage: suite_bench [--csv] [-u {threads}] [--min-shells {count}] [scenario names...]
+ * Every scenario is a board generated from a fixed spec (see BoardSpec), so it plays out the same on
+ * every run unless the engine or the algorithms change: its winner and number of rounds are printed
+ * along with its speed, and a change in them flags a change in behavior. The scenarios are:
+ *   open-field    a large, sparsely walled board, played by the real tank algorithms
+ *   maze          a maze of one-cell corridors, played by the real tank algorithms
+ *   shell-storm   over a thousand tanks that do nothing but turn and shoot, so the engine is kept busy
+ *                 with thousands of shells
+ *   many-tanks    hundreds of tanks on a walled and mined board, played by the real tank algorithms
+ * Each one runs in a process of its own, so that its peak memory (the maximal resident set size) is its
+ * own. The rounds are counted as GameManager::run() counts them, the shells' half-rounds included. The
+ * tanks' own BFS runs and the distance fields their players built are counted apart, as the game's
+ * profile counts them (see GameProfile), so that a change in how often the fields are reused does not
+ * show up as a change in the number of searches.
+ * -u and --min-shells are passed on to GameManager::setUpdateThreads(), so that the shell-storm can be
+ * played with its shells updated serially and in parallel, and the point at which the parallel update
+ * starts paying off found.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "board_generator.h"
+#include "gamemanager.h"
+#include "MyPlayerFactory.h"
+#include "MyTankAlgorithmFactory.h"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+/** A tank algorithm that only turns and shoots, to fill the board with shells. */
+class ShooterTankAlgorithm : public TankAlgorithm {
+    private:
+        size_t step_;
+
+    public:
+        ShooterTankAlgorithm(int tank_index) : step_(tank_index) {}
+
+        ActionRequest getAction() override {
+            return (step_++ % 2 == 0) ? ActionRequest::Shoot : ActionRequest::RotateRight45;
+        }
+
+        void updateBattleInfo(BattleInfo& info) override { (void)info; }
+};
+
+class ShooterTankAlgorithmFactory : public TankAlgorithmFactory {
+    public:
+        unique_ptr<TankAlgorithm> create(int player_index, int tank_index) const override {
+            (void)player_index;
+            return make_unique<ShooterTankAlgorithm>(tank_index);
+        }
+};
+
+struct Scenario {
+    string name;
+    BoardSpec spec;
+    bool shooters;      /* Played by ShooterTankAlgorithm rather than the real tank algorithms. */
+};
+
+static vector<Scenario> scenarios() {
+    vector<Scenario> list;
+    BoardSpec open_field;
+    open_field.rows = 150;
+    open_field.columns = 150;
+    open_field.wallDensity = 0.05;
+    open_field.mineDensity = 0.01;
+    open_field.tanksPerPlayer = 6;
+    open_field.maxSteps = 1000;
+    open_field.seed = 1;
+    list.push_back({"open-field", open_field, false});
+
+    BoardSpec maze;
+    maze.rows = 81;
+    maze.columns = 81;
+    maze.layout = BoardSpec::MAZE;
+    maze.wallDensity = 0.05;
+    maze.mineDensity = 0.0;
+    maze.tanksPerPlayer = 6;
+    maze.maxSteps = 1000;
+    maze.seed = 2;
+    list.push_back({"maze", maze, false});
+
+    BoardSpec shell_storm;
+    shell_storm.rows = 800;
+    shell_storm.columns = 800;
+    shell_storm.wallDensity = 0.02;
+    shell_storm.mineDensity = 0.0;
+    shell_storm.tanksPerPlayer = 800;
+    shell_storm.maxSteps = 300;
+    shell_storm.numShells = 1000;
+    shell_storm.seed = 3;
+    list.push_back({"shell-storm", shell_storm, true});
+
+    BoardSpec many_tanks;
+    many_tanks.rows = 200;
+    many_tanks.columns = 200;
+    many_tanks.wallDensity = 0.10;
+    many_tanks.mineDensity = 0.01;
+    many_tanks.tanksPerPlayer = 60;
+    many_tanks.maxSteps = 300;
+    many_tanks.seed = 4;
+    list.push_back({"many-tanks", many_tanks, false});
+    return list;
+}
+
+/** How the scenarios are played and reported, as given on the command line. */
+struct Options {
+    bool csv = false;
+    int updateThreads = 1;
+    size_t minParallelShells = Board::DEFAULT_MIN_PARALLEL_SHELLS;
+};
+
+/** Plays the given scenario and prints its results, as a table row or as a CSV line. Meant to run in a
+ * process of its own, whose peak memory is then the scenario's. */
+static void runScenario(const Scenario& scenario, const Options& options) {
+    string input_file = "input_" + scenario.name + ".txt";
+    writeBoardFile(input_file, scenario.spec);
+    fs::remove("output_" + scenario.name + ".txt");
+
+    unique_ptr<TankAlgorithmFactory> tank_factory;
+    if (scenario.shooters) { tank_factory = make_unique<ShooterTankAlgorithmFactory>(); }
+    else { tank_factory = make_unique<MyTankAlgorithmFactory>(); }
+    GameManager game(make_unique<MyPlayerFactory>(), std::move(tank_factory));
+    game.setConsoleOutput(false);
+    game.setProfiling(true);
+    game.setUpdateThreads(options.updateThreads, options.minParallelShells);
+    game.readBoard(input_file);
+    game.run();
+
+    const GameProfile& profile = *game.getProfile();
+    double seconds = chrono::duration<double>(profile.getTotalTime()).count();
+    double rounds_per_second = seconds > 0 ? profile.getHalfRounds() / seconds : 0.0;
+    double bfs_per_second = seconds > 0 ? profile.getBfsRuns() / seconds : 0.0;
+    double fields_per_second = seconds > 0 ? profile.getDistanceFieldsBuilt() / seconds : 0.0;
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    double peak_mb = usage.ru_maxrss / 1024.0;      /* Linux reports it in kilobytes. */
+    const BoardSpec& spec = scenario.spec;
+    string board = to_string(spec.rows) + "x" + to_string(spec.columns) + ", " +
+        to_string(2 * spec.tanksPerPlayer) + " tanks";
+
+    if (options.csv) {
+        cout << scenario.name << ',' << spec.rows << ',' << spec.columns << ',' << 2 * spec.tanksPerPlayer
+             << ',' << game.getWinner() << ',' << profile.getHalfRounds() << ','
+             << fixed << setprecision(3) << seconds << ',' << setprecision(1) << rounds_per_second << ','
+             << profile.getBfsRuns() << ',' << bfs_per_second << ',' << profile.getDistanceFieldsBuilt()
+             << ',' << fields_per_second << ',' << peak_mb << '\n';
+        return;
+    }
+    cout << left << setw(13) << scenario.name << setw(22) << board << right << setw(7) << game.getWinner()
+         << setw(8) << profile.getHalfRounds() << fixed << setprecision(3) << setw(10) << seconds
+         << setprecision(1) << setw(12) << rounds_per_second << setw(9) << profile.getBfsRuns()
+         << setw(12) << bfs_per_second << setw(9) << profile.getDistanceFieldsBuilt() << setw(12)
+         << fields_per_second << setw(10) << peak_mb << '\n';
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    vector<string> names;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--csv") { options.csv = true; }
+        else if (arg == "-u" && i + 1 < argc) { options.updateThreads = stoi(argv[++i]); }
+        else if (arg == "--min-shells" && i + 1 < argc) { options.minParallelShells = stoul(argv[++i]); }
+        else { names.push_back(arg); }
+    }
+    vector<Scenario> selected;
+    for (const Scenario& scenario : scenarios()) {
+        if (names.empty() || find(names.begin(), names.end(), scenario.name) != names.end()) {
+            selected.push_back(scenario);
+        }
+    }
+    if (selected.empty()) {
+        cout << "no such scenario!\n";
+        return 1;
+    }
+
+    fs::path work_dir = fs::temp_directory_path() / "tanks_suite_bench";
+    fs::create_directories(work_dir);
+    fs::current_path(work_dir);
+    BaseTankAlgorithm::setDebugOutput(false);
+
+    if (options.csv) {
+        cout << "scenario,rows,columns,tanks,winner,rounds,seconds,rounds_per_s,bfs_runs,bfs_per_s,"
+             << "fields_built,fields_per_s,peak_rss_mb\n";
+    } else {
+        cout << left << setw(13) << "Scenario" << setw(22) << "Board" << right << setw(7) << "Winner"
+             << setw(8) << "Rounds" << setw(10) << "Time (s)" << setw(12) << "Rounds/s" << setw(9)
+             << "BFS" << setw(12) << "BFS/s" << setw(9) << "Fields" << setw(12) << "Fields/s" << setw(10)
+             << "Peak MB" << '\n';
+    }
+    int failures = 0;
+    for (const Scenario& scenario : selected) {
+        cout.flush();
+        pid_t child = fork();
+        if (child == 0) {
+            int status = 0;
+            try {
+                runScenario(scenario, options);
+            } catch (const exception& e) {
+                cerr << "Error in " << scenario.name << ": " << e.what() << '\n';
+                status = 1;
+            }
+            cout.flush();
+            _exit(status);
+        }
+        int status = 0;
+        bool failed = child < 0 || waitpid(child, &status, 0) < 0;
+        if (failed || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            cerr << scenario.name << " failed\n";
+            failures++;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <stdexcept>
 #include <vector>
 #include <string>
 #include "gamemanager.h"
@@ -9,18 +10,83 @@
 
 using namespace std;
 
+/** Reads the given value of the given option as a whole number no smaller than the given minimum, or
+ * throws an invalid_argument naming the option. */
+static int parseFlagValue(const string& flag, const string& value, int minimum) {
+    size_t parsed = 0;
+    int result = 0;
+    try { result = stoi(value, &parsed); }
+    catch (const exception&) { parsed = 0; }
+    if (parsed == 0 || parsed != value.size() || result < minimum) {
+        throw invalid_argument("Invalid value for " + flag + ": " + value);
+    }
+    return result;
+}
+
 int main(int argc, char* argv[]) {
-    if (argc != 2) {
+    // --headless only writes the output file: no board rendering and no action or debug printing,
+    // -j {threads} lets the tanks decide their actions in parallel (the game plays out the same),
+    // -u {threads} updates the shells of large boards in parallel (the game plays out the same too),
+    // -r {repetitions} ends the game in a tie once the same state has been repeated that many times,
+    // --profile prints where the game's time went once it is over (--profile-csv {file} writes it as CSV
+    // to the given file instead), and --replay {file} records the game into a replay file for bin/replay,
+    // with a keyframe every 64 turns or every --keyframes {turns}
+    bool headless = false;
+    bool profile = false;
+    string profileCsv;
+    string replayFile;
+    int keyframes = 64;
+    int threads = 1;
+    int updateThreads = 1;
+    int repetitions = 0;
+    if (argc < 2) {
         cout << "no input file given!\n";
         return 1;
     }
     try {
+        /* The input file is always the last argument, so an option's value must come before it. */
+        int argInd = 1;
+        auto flagValue = [&](const string& flag) -> string {
+            if (argInd + 2 >= argc) { throw invalid_argument("Missing value for " + flag); }
+            return argv[++argInd];
+        };
+        for (; argInd < argc - 1; ++argInd) {
+            string arg = argv[argInd];
+            if (arg == "--headless") { headless = true; }
+            else if (arg == "-j") { threads = parseFlagValue(arg, flagValue(arg), 1); }
+            else if (arg == "-u") { updateThreads = parseFlagValue(arg, flagValue(arg), 1); }
+            else if (arg == "-r") { repetitions = parseFlagValue(arg, flagValue(arg), 0); }
+            else if (arg == "--profile") { profile = true; }
+            else if (arg == "--profile-csv") {
+                profile = true;
+                profileCsv = flagValue(arg);
+            }
+            else if (arg == "--replay") { replayFile = flagValue(arg); }
+            else if (arg == "--keyframes") { keyframes = parseFlagValue(arg, flagValue(arg), 1); }
+            else { throw invalid_argument("Unknown option: " + arg); }
+        }
+
         auto playerFactory = std::make_unique<MyPlayerFactory>();
         auto tankFactory = std::make_unique<MyTankAlgorithmFactory>();
         GameManager game(std::move(playerFactory), std::move(tankFactory));
+        if (headless) {
+            game.setConsoleOutput(false);
+            BaseTankAlgorithm::setDebugOutput(false);
+        }
+        game.setDecisionThreads(threads);
+        game.setUpdateThreads(updateThreads);
+        game.setRepetitionLimit(repetitions);
+        game.setProfiling(profile);
+        game.setReplayFile(replayFile, keyframes);
 
-        game.readBoard(argv[1]);
+        game.readBoard(argv[argc - 1]);
         game.run();
+        if (profile && profileCsv.empty()) { game.getProfile()->writeTable(cout); }
+        else if (profile) {
+            ofstream csv(profileCsv);
+            if (!csv.is_open()) { throw runtime_error("Failed to open profile file: " + profileCsv); }
+            game.getProfile()->writeCsv(csv);
+        }
     } catch (const exception& e) {
         cerr << "Error: " << e.what() << endl;
         return 1;
@@ -0,0 +1,97 @@
+/**
+ * @file replay.cpp
+ * @brief A tool printing, and checking, the games recorded into replay files by tanks_game --replay.
+ * The maximal number of columns in a comment-line in this file is 106.
+ *
+ * Usage: replay {replay file}              prints how the game went and where its keyframes are
+ *        replay {replay file} {turn}       prints the board and the tanks at the start of the given turn
+ *        replay --verify {replay file}     plays every stretch between keyframes forward from the first,
+ *                                          and checks that it ends in the next one
+ * A turn's state is rebuilt from the last keyframe before it and the tanks' recorded actions alone (see
+ * ReplayReader::getState()), so no tank algorithm is run.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "replay_file.h"
+
+using namespace std;
+
+/** Prints how the recorded game went, and where its keyframes are. */
+static void printSummary(ReplayReader& reader) {
+    vector<int> keyframes = reader.getKeyframeTurns();
+    cout << "Tanks:        " << reader.getTanks() << '\n'
+         << "Turns:        " << reader.getTurns() << '\n'
+         << "Keyframes:    " << keyframes.size() << " (every " << reader.getKeyframeInterval()
+         << " turns)\n";
+    if (reader.getWinner() < 0) { cout << "Result:       unfinished (the replay has no index)\n"; }
+    else if (reader.getWinner() == 0) {
+        cout << "Result:       tie after " << reader.getRounds() << " rounds\n";
+    }
+    else {
+        cout << "Result:       player " << reader.getWinner() << " won after " << reader.getRounds()
+             << " rounds\n";
+    }
+}
+
+/** Prints the board and the tanks of the given state, rebuilt for the given turn. */
+static void printState(GameState& state, int turn) {
+    Board& board = state.getBoard();
+    cout << "Turn " << turn << " (round " << state.getRounds() << "): player 1 has "
+         << board.getPlayerATanks() << " tanks, player 2 has " << board.getPlayerBTanks() << " tanks, "
+         << board.getShells().size() << " shells in flight\n";
+    board.render();
+    for (int tankInd = 0; tankInd < board.getNumTanks(); ++tankInd) {
+        pair<int, int> pos = board.getPosTank(tankInd);
+        cout << "Tank " << tankInd << ": ";
+        if (board.isTankAlive(tankInd)) { cout << "at (" << pos.first << ", " << pos.second << ")\n"; }
+        else { cout << "dead\n"; }
+    }
+}
+
+/** Plays every stretch between two keyframes forward from the first of them, and checks that it ends in
+ * the second. Returns the number of stretches that did not. */
+static int verify(ReplayReader& reader) {
+    vector<int> keyframes = reader.getKeyframeTurns();
+    int mismatches = 0;
+    for (size_t keyframe = 0; keyframe + 1 < keyframes.size(); ++keyframe) {
+        GameState state = reader.readKeyframe(keyframe);
+        for (const vector<ActionRequest>& actions : reader.readTurns(keyframe)) { state.step(actions); }
+        if (state != reader.readKeyframe(keyframe + 1)) {
+            cout << "Turns " << keyframes[keyframe] << " to " << keyframes[keyframe + 1]
+                 << " do not lead to the keyframe of turn " << keyframes[keyframe + 1] << '\n';
+            mismatches++;
+        }
+    }
+    size_t stretches = keyframes.empty() ? 0 : keyframes.size() - 1;
+    cout << stretches - mismatches << " of " << stretches
+         << " keyframes reached by replaying the turns before them\n";
+    return mismatches;
+}
+
+int main(int argc, char* argv[]) {
+    bool verifying = argc == 3 && string(argv[1]) == "--verify";
+    if (argc < 2 || argc > 3) {
+        cout << "usage: replay [--verify] {replay file} [turn]\n";
+        return 1;
+    }
+    try {
+        ReplayReader reader(argv[verifying ? 2 : 1]);
+        if (verifying) { return verify(reader) == 0 ? 0 : 1; }
+        printSummary(reader);
+        if (argc == 3) {
+            int turn = stoi(argv[2]);
+            auto start = chrono::steady_clock::now();
+            GameState state = reader.getState(turn);
+            chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+            cout << "Rebuilt in " << elapsed.count() << " ms\n";
+            printState(state, turn);
+        }
+    } catch (const exception& e) {
+        cerr << "Error: " << e.what() << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -1,11 +1,27 @@
 #include "BaseBattleInfo.h"
 
-const std::vector<std::vector<char>>& BaseBattleInfo::getGrid() const {
+const BaseBattleInfo::Grid& BaseBattleInfo::getGrid() const {
+    return *grid_;
+}
+
+const std::shared_ptr<const BaseBattleInfo::Grid>& BaseBattleInfo::getGridSnapshot() const {
     return grid_;
 }
 
-void BaseBattleInfo::setGrid(const std::vector<std::vector<char>>& grid) {
-    grid_ = grid;
+std::pair<int, int> BaseBattleInfo::getMyPos() const {
+    return myPos_;
+}
+
+void BaseBattleInfo::setGrid(const Grid& grid) {
+    grid_ = std::make_shared<const Grid>(grid);
+}
+
+void BaseBattleInfo::setGrid(std::shared_ptr<const Grid> grid) {
+    grid_ = std::move(grid);
+}
+
+void BaseBattleInfo::setMyPos(std::pair<int, int> pos) {
+    myPos_ = pos;
 }
 
 int BaseBattleInfo::getNumShells(){
@@ -14,4 +30,36 @@ int BaseBattleInfo::getNumShells(){
 
 void BaseBattleInfo::setNumShells(int ammo){
     numShells_ = ammo;
+}
+
+const std::shared_ptr<const DistanceField>& BaseBattleInfo::getDistanceField() const {
+    return distanceField_;
+}
+
+void BaseBattleInfo::setDistanceField(std::shared_ptr<const DistanceField> distance_field) {
+    distanceField_ = std::move(distance_field);
+}
+
+const std::shared_ptr<const SightTable>& BaseBattleInfo::getSightTable() const {
+    return sightTable_;
+}
+
+void BaseBattleInfo::setSightTable(std::shared_ptr<const SightTable> sight_table) {
+    sightTable_ = std::move(sight_table);
+}
+
+const std::shared_ptr<const ThreatMap>& BaseBattleInfo::getThreatMap() const {
+    return threatMap_;
+}
+
+void BaseBattleInfo::setThreatMap(std::shared_ptr<const ThreatMap> threat_map) {
+    threatMap_ = std::move(threat_map);
+}
+
+unsigned long BaseBattleInfo::getObstaclesVersion() const {
+    return obstaclesVersion_;
+}
+
+void BaseBattleInfo::setObstaclesVersion(unsigned long version) {
+    obstaclesVersion_ = version;
 }
\ No newline at end of file
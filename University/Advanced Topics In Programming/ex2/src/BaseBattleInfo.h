@@ -1,16 +1,44 @@
 #pragma once
 #include "BattleInfo.h"
+#include "distance_field.h"
+#include "sight_table.h"
+#include "threat_map.h"
 #include <vector>
 #include <memory>
+#include <utility>
 
 class BaseBattleInfo : public BattleInfo {
+    public:
+        using Grid = std::vector<std::vector<char>>;
+
     private:
-        std::vector<std::vector<char>> grid_;
+        // Shared and read-only, so a snapshot of the satellite view can be passed on without copying it
+        std::shared_ptr<const Grid> grid_ = std::make_shared<const Grid>();
+        std::pair<int, int> myPos_ = {-1, -1};
         int numShells_;
+        std::shared_ptr<const DistanceField> distanceField_;
+        std::shared_ptr<const SightTable> sightTable_;
+        std::shared_ptr<const ThreatMap> threatMap_;
+        unsigned long obstaclesVersion_ = 0;
 
     public:
-        const std::vector<std::vector<char>>& getGrid() const;
+        const Grid& getGrid() const;
+        const std::shared_ptr<const Grid>& getGridSnapshot() const;
+        // The (row, column) of the tank receiving this info, or (-1, -1) if it should look for its '%'
+        std::pair<int, int> getMyPos() const;
         int getNumShells();
-        void setGrid(const std::vector<std::vector<char>>& grid);
+        void setGrid(const Grid& grid);
+        void setGrid(std::shared_ptr<const Grid> grid);
+        void setMyPos(std::pair<int, int> pos);
         void setNumShells(int ammo);
+        const std::shared_ptr<const DistanceField>& getDistanceField() const;
+        void setDistanceField(std::shared_ptr<const DistanceField> distance_field);
+        const std::shared_ptr<const SightTable>& getSightTable() const;
+        void setSightTable(std::shared_ptr<const SightTable> sight_table);
+        const std::shared_ptr<const ThreatMap>& getThreatMap() const;
+        void setThreatMap(std::shared_ptr<const ThreatMap> threat_map);
+        // Changes whenever the grid's walls or mines do (see BaseSatelliteView::getObstaclesVersion()),
+        // or 0 if unknown
+        unsigned long getObstaclesVersion() const;
+        void setObstaclesVersion(unsigned long version);
 };
\ No newline at end of file
@@ -1,6 +1,11 @@
 #include "BasePlayer.h"
 #include "TankAlgorithm.h"
 #include "SatelliteView.h"
+#include "BaseSatelliteView.h"
+#include <cctype>
+
+std::atomic<unsigned long> BasePlayer::totalDistanceFieldLookups_ = 0;
+std::atomic<unsigned long> BasePlayer::totalDistanceFieldBuilds_ = 0;
 
 BasePlayer::BasePlayer(int player_index, size_t x, size_t y, size_t max_steps, size_t num_shells)
     : Player(player_index, x, y, max_steps, num_shells),
@@ -9,7 +14,17 @@ BasePlayer::BasePlayer(int player_index, size_t x, size_t y, size_t max_steps, s
       columns_(y),
       maxSteps_(max_steps),
       numShells_(num_shells),
-      livingTanks_(0) {}
+      livingTanks_(0),
+      distanceField_(nullptr),
+      distanceFieldVersion_(0),
+      distanceFieldObstaclesVersion_(0),
+      distanceFieldSources_(),
+      sightTable_(nullptr),
+      sightTableVersion_(0),
+      threatMap_(nullptr),
+      threatMapVersion_(0),
+      distanceFieldLookups_(0),
+      distanceFieldBuilds_(0) {}
 
 // Getters
 int BasePlayer::getPlayerIndex() const {
@@ -65,18 +80,106 @@ void BasePlayer::increaseLivingTanks() {
     livingTanks_ += 1;
 }
 
-void BasePlayer::updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satellite_view) {
-    std::vector<std::vector<char>> grid(rows_, std::vector<char>(columns_));  // <-- fixed typo here
+std::shared_ptr<const DistanceField> BasePlayer::getDistanceField(const std::vector<std::vector<char>>& grid,
+    const SatelliteView& satellite_view) {
+    const BaseSatelliteView* baseView = dynamic_cast<const BaseSatelliteView*>(&satellite_view);
+    distanceFieldLookups_++;
+    totalDistanceFieldLookups_.fetch_add(1, std::memory_order_relaxed);
+    if (distanceField_ && baseView && baseView->getVersion() == distanceFieldVersion_) {
+        return distanceField_;
+    }
+
+    std::vector<std::pair<int, int>> enemies;
+    for (size_t row = 0; row < grid.size(); ++row) {
+        for (size_t col = 0; col < grid[row].size(); ++col) {
+            char cell = grid[row][col];
+            if (isdigit(cell) && cell - '0' != playerInd_) {
+                enemies.emplace_back(row, col);
+            }
+        }
+    }
+    int rows = grid.size();
+    int columns = grid.empty() ? 0 : grid[0].size();
+    // The field only depends on where it can step and where it leads to, so shells flying around and
+    // allied tanks moving leave it as it is
+    if (distanceField_ && baseView && baseView->getObstaclesVersion() == distanceFieldObstaclesVersion_ &&
+        distanceField_->getRows() == rows && distanceField_->getColumns() == columns &&
+        enemies == distanceFieldSources_) {
+        distanceFieldVersion_ = baseView->getVersion();
+        return distanceField_;
+    }
+
+    if (!neighborTable_ || neighborTable_->getRows() != rows || neighborTable_->getColumns() != columns) {
+        neighborTable_ = NeighborTable::getShared(rows, columns);
+    }
+    distanceFieldBuilds_++;
+    totalDistanceFieldBuilds_.fetch_add(1, std::memory_order_relaxed);
+    distanceField_ = std::make_shared<const DistanceField>(grid, enemies, *neighborTable_);
+    distanceFieldVersion_ = baseView ? baseView->getVersion() : 0;
+    distanceFieldObstaclesVersion_ = baseView ? baseView->getObstaclesVersion() : 0;
+    distanceFieldSources_ = std::move(enemies);
+    return distanceField_;
+}
+
+std::shared_ptr<const SightTable> BasePlayer::getSightTable(const std::vector<std::vector<char>>& grid,
+    const SatelliteView& satellite_view) {
+    const BaseSatelliteView* baseView = dynamic_cast<const BaseSatelliteView*>(&satellite_view);
+    if (sightTable_ && baseView && baseView->getWallsVersion() == sightTableVersion_) {
+        return sightTable_;
+    }
+
+    sightTable_ = std::make_shared<const SightTable>(grid);
+    sightTableVersion_ = baseView ? baseView->getWallsVersion() : 0;
+    return sightTable_;
+}
+
+std::shared_ptr<const ThreatMap> BasePlayer::getThreatMap(const std::vector<std::vector<char>>& grid,
+    const SatelliteView& satellite_view) {
+    const BaseSatelliteView* baseView = dynamic_cast<const BaseSatelliteView*>(&satellite_view);
+    if (threatMap_ && baseView && baseView->getVersion() == threatMapVersion_) {
+        return threatMap_;
+    }
+
+    threatMap_ = std::make_shared<const ThreatMap>(grid);
+    threatMapVersion_ = baseView ? baseView->getVersion() : 0;
+    return threatMap_;
+}
+
+std::shared_ptr<const std::vector<std::vector<char>>> BasePlayer::getGridSnapshot(
+    const SatelliteView& satellite_view) const {
+    const BaseSatelliteView* baseView = dynamic_cast<const BaseSatelliteView*>(&satellite_view);
+    if (baseView) {
+        return baseView->getSnapshot();
+    }
 
+    auto grid = std::make_shared<std::vector<std::vector<char>>>(rows_, std::vector<char>(columns_));
     for (size_t y = 0; y < rows_; ++y) {
         for (size_t x = 0; x < columns_; ++x) {
-            grid[y][x] = satellite_view.getObjectAt(x, y);
+            (*grid)[y][x] = satellite_view.getObjectAt(x, y);
         }
     }
+    return grid;
+}
+
+std::pair<int, int> BasePlayer::getCurrTankPos(const SatelliteView& satellite_view) const {
+    const BaseSatelliteView* baseView = dynamic_cast<const BaseSatelliteView*>(&satellite_view);
+    return baseView ? baseView->getCurrTankPos() : std::pair<int, int>(-1, -1);
+}
 
+unsigned long BasePlayer::getObstaclesVersion(const SatelliteView& satellite_view) const {
+    const BaseSatelliteView* baseView = dynamic_cast<const BaseSatelliteView*>(&satellite_view);
+    return baseView ? baseView->getObstaclesVersion() : 0;
+}
+
+void BasePlayer::updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satellite_view) {
     BaseBattleInfo battleInfo;
-    battleInfo.setGrid(grid);
+    battleInfo.setGrid(getGridSnapshot(satellite_view));
+    battleInfo.setMyPos(getCurrTankPos(satellite_view));
     battleInfo.setNumShells(numShells_);
+    battleInfo.setDistanceField(getDistanceField(battleInfo.getGrid(), satellite_view));
+    battleInfo.setSightTable(getSightTable(battleInfo.getGrid(), satellite_view));
+    battleInfo.setThreatMap(getThreatMap(battleInfo.getGrid(), satellite_view));
+    battleInfo.setObstaclesVersion(getObstaclesVersion(satellite_view));
 
     tank.updateBattleInfo(battleInfo);
 }
\ No newline at end of file
@@ -1,6 +1,9 @@
 #pragma once
 #include "Player.h"
 #include "BaseBattleInfo.h"
+#include "SatelliteView.h"
+#include <atomic>
+#include <memory>
 #include <vector>
 
 class BasePlayer : public Player {
@@ -11,6 +14,45 @@ private:
     size_t maxSteps_;
     size_t numShells_;
     int livingTanks_;
+    std::shared_ptr<const DistanceField> distanceField_;
+    unsigned long distanceFieldVersion_;
+    unsigned long distanceFieldObstaclesVersion_;
+    std::vector<std::pair<int, int>> distanceFieldSources_;
+    std::shared_ptr<const NeighborTable> neighborTable_;
+    std::shared_ptr<const SightTable> sightTable_;
+    unsigned long sightTableVersion_;
+    std::shared_ptr<const ThreatMap> threatMap_;
+    unsigned long threatMapVersion_;
+    // How often this player's distance field was asked for, and how many of those times it had to be
+    // rebuilt
+    unsigned long distanceFieldLookups_;
+    unsigned long distanceFieldBuilds_;
+    // The same counts, summed over all players (of all games running at once)
+    static std::atomic<unsigned long> totalDistanceFieldLookups_;
+    static std::atomic<unsigned long> totalDistanceFieldBuilds_;
+
+protected:
+    // Distance field from every enemy tank in the given grid, shared by all of this player's tanks and
+    // rebuilt only once the walls, the mines or the enemy tanks have changed since it was last built
+    std::shared_ptr<const DistanceField> getDistanceField(const std::vector<std::vector<char>>& grid,
+        const SatelliteView& satellite_view);
+    // Lines of sight over the walls of the given grid, shared by all of this player's tanks and rebuilt
+    // only once the walls on the satellite view have changed since it was last built
+    std::shared_ptr<const SightTable> getSightTable(const std::vector<std::vector<char>>& grid,
+        const SatelliteView& satellite_view);
+    // The shells' threats on the given grid, shared by all of this player's tanks and rebuilt only once
+    // the satellite view has changed since it was last built
+    std::shared_ptr<const ThreatMap> getThreatMap(const std::vector<std::vector<char>>& grid,
+        const SatelliteView& satellite_view);
+    // The satellite view's grid, shared without copying if it is a BaseSatelliteView, or else read from it
+    // cell by cell (with the current tank marked '%')
+    std::shared_ptr<const std::vector<std::vector<char>>> getGridSnapshot(
+        const SatelliteView& satellite_view) const;
+    // The current tank's (row, column) if the satellite view can tell it directly, or (-1, -1)
+    std::pair<int, int> getCurrTankPos(const SatelliteView& satellite_view) const;
+    // The satellite view's obstacles version (see BaseSatelliteView::getObstaclesVersion()), or 0 if it
+    // cannot tell
+    unsigned long getObstaclesVersion(const SatelliteView& satellite_view) const;
 
 public:
     // Constructor
@@ -23,6 +65,10 @@ public:
     size_t getMaxSteps() const;
     size_t getNumShells() const;
     int getLivingTanks() const;
+    unsigned long getDistanceFieldLookups() const { return distanceFieldLookups_; }
+    unsigned long getDistanceFieldBuilds() const { return distanceFieldBuilds_; }
+    static unsigned long getTotalDistanceFieldLookups() { return totalDistanceFieldLookups_; }
+    static unsigned long getTotalDistanceFieldBuilds() { return totalDistanceFieldBuilds_; }
 
     // Setter methods
     void setPlayerIndex(int index);
@@ -1,15 +1,30 @@
 #include "BaseSatelliteView.h"
 
-const std::vector<std::vector<char>>& BaseSatelliteView::getGrid() const {
-    return grid_;
+static bool isObstacle(char c) {
+    return c == '#' || c == '@';
+}
+
+BaseSatelliteView::Grid& BaseSatelliteView::writableGrid() {
+    if (grid_.use_count() > 1) {
+        grid_ = std::make_shared<Grid>(*grid_);
+    }
+    return *grid_;
+}
+
+const BaseSatelliteView::Grid& BaseSatelliteView::getGrid() const {
+    return *grid_;
 }
 
-void BaseSatelliteView::setGrid(const std::vector<std::vector<char>>& grid) {
-    grid_ = grid;
+void BaseSatelliteView::setGrid(const Grid& grid) {
+    grid_ = std::make_shared<Grid>(grid);
+    version_++;
+    wallsVersion_++;
+    obstaclesVersion_++;
 }
 
 char BaseSatelliteView::getObjectAt(size_t x, size_t y) const {
-    if (y >= grid_.size() || x >= grid_[y].size()) {
+    const Grid& grid = *grid_;
+    if (y >= grid.size() || x >= grid[y].size()) {
         return '&'; // Out of bounds
     }
     
@@ -20,7 +35,19 @@ char BaseSatelliteView::getObjectAt(size_t x, size_t y) const {
         }
     }
 
-    return grid_[y][x]; // grid is row-major: grid_[y][x]
+    return grid[y][x]; // grid is row-major: grid[y][x]
+}
+
+std::shared_ptr<const BaseSatelliteView::Grid> BaseSatelliteView::getSnapshot() const {
+    return grid_;
+}
+
+std::pair<int, int> BaseSatelliteView::getCurrTankPos() const {
+    if (currTankInd_ < 0 || static_cast<size_t>(currTankInd_) >= positions_.size()) {
+        return {-1, -1};
+    }
+    const auto& currPos = positions_[currTankInd_];
+    return {static_cast<int>(currPos.first), static_cast<int>(currPos.second)};
 }
 
 const std::vector<std::pair<size_t, size_t>>& BaseSatelliteView::getPositions() const {
@@ -29,15 +56,18 @@ const std::vector<std::pair<size_t, size_t>>& BaseSatelliteView::getPositions()
 
 void BaseSatelliteView::setPositions(const std::vector<std::pair<size_t, size_t>>& positions) {
     positions_ = positions;
+    version_++;
 }
 
 void BaseSatelliteView::addPosition(size_t x, size_t y) {
     positions_.emplace_back(x, y);
+    version_++;
 }
 
 void BaseSatelliteView::setPosition(size_t index, size_t x, size_t y) {
-    if (index < positions_.size()) {
+    if (index < positions_.size() && positions_[index] != std::pair<size_t, size_t>(x, y)) {
         positions_[index] = {x, y};
+        version_++;
     }
 }
 
@@ -45,21 +75,55 @@ void BaseSatelliteView::setCurrTankInd(int ind) {
     currTankInd_ = ind;
 }
 
-void BaseSatelliteView::updateGrid(const std::vector<std::vector<std::string>>& newGrid) {
-    for (size_t y = 0; y < newGrid.size(); ++y) {
-        for (size_t x = 0; x < newGrid[y].size(); ++x) {
-            if (newGrid[y][x] == "."){
-                grid_[y][x] = ' ';
-            }
-            else if (!newGrid[y][x].empty()) {
-                grid_[y][x] = newGrid[y][x][0];
-            } else {
-                grid_[y][x] = ' ';
-            }
+unsigned long BaseSatelliteView::getVersion() const {
+    return version_;
+}
+
+unsigned long BaseSatelliteView::getWallsVersion() const {
+    return wallsVersion_;
+}
+
+unsigned long BaseSatelliteView::getObstaclesVersion() const {
+    return obstaclesVersion_;
+}
+
+void BaseSatelliteView::updateGrid(const std::vector<Cell>& cells) {
+    version_++;
+    wallsVersion_++;
+    obstaclesVersion_++;
+    Grid& grid = writableGrid();
+    size_t i = 0;
+    for (size_t y = 0; y < grid.size(); ++y) {
+        for (size_t x = 0; x < grid[y].size(); ++x) {
+            grid[y][x] = cellToChar(cells[i++]);
         }
     }
 }
 
+void BaseSatelliteView::updateCells(const std::vector<Cell>& cells, const std::vector<int>& dirtyCells) {
+    if (grid_->empty() || dirtyCells.empty()) {
+        return;
+    }
+    size_t width = (*grid_)[0].size();
+    bool changed = false;
+    for (int index : dirtyCells) {
+        char updated = cellToChar(cells[index]);
+        char& current = (*grid_)[index / width][index % width];
+        if (current != updated) {
+            if ((current == '#') != (updated == '#')) { wallsVersion_++; }
+            if (isObstacle(current) != isObstacle(updated)) { obstaclesVersion_++; }
+            writableGrid()[index / width][index % width] = updated;
+            changed = true;
+        }
+    }
+    if (changed) {
+        version_++;
+    }
+}
+
 void BaseSatelliteView::initializeGrid(size_t height, size_t width) {
-    grid_ = std::vector<std::vector<char>>(height, std::vector<char>(width, ' '));
+    grid_ = std::make_shared<Grid>(height, std::vector<char>(width, ' '));
+    version_++;
+    wallsVersion_++;
+    obstaclesVersion_++;
 }
\ No newline at end of file
@@ -1,35 +1,68 @@
 #pragma once
 
 #include "SatelliteView.h"
+#include "cell.h"
+#include <memory>
 #include <vector>
 #include <utility>
 
 class BaseSatelliteView : public SatelliteView {
+public:
+    using Grid = std::vector<std::vector<char>>;
+
 private:
-    std::vector<std::vector<char>> grid_;
+    // Copy-on-write: snapshots handed out by getSnapshot() share this grid, and the view only copies it
+    // if it has to change while a snapshot is still held
+    std::shared_ptr<Grid> grid_ = std::make_shared<Grid>();
     std::vector<std::pair<size_t, size_t>> positions_;
-    int currTankInd_;
+    int currTankInd_ = -1;
+    unsigned long version_ = 0;
+    unsigned long wallsVersion_ = 0;
+    unsigned long obstaclesVersion_ = 0;
+
+    Grid& writableGrid();
 
 public:
     virtual ~BaseSatelliteView() override = default;
 
-    const std::vector<std::vector<char>>& getGrid() const;
+    const Grid& getGrid() const;
 
-    void setGrid(const std::vector<std::vector<char>>& grid);
+    void setGrid(const Grid& grid);
 
     char getObjectAt(size_t x, size_t y) const override;
 
+    // A read-only snapshot of the whole grid, which does not mark the current tank with '%' (see
+    // getCurrTankPos()) and stays unchanged as the view is updated
+    std::shared_ptr<const Grid> getSnapshot() const;
+
+    // The (row, column) of the current tank, or (-1, -1) if there is none
+    std::pair<int, int> getCurrTankPos() const;
+
     const std::vector<std::pair<size_t, size_t>>& getPositions() const;
 
     void setPositions(const std::vector<std::pair<size_t, size_t>>& positions);
 
     void addPosition(size_t x, size_t y);
 
+    // Only counts as a change (see getVersion()) if the position actually moved
     void setPosition(size_t index, size_t x, size_t y);
 
     void setCurrTankInd(int ind);
 
-    void updateGrid(const std::vector<std::vector<std::string>>& newGrid);
+    // Bumped whenever the grid or the tank positions change, so players can tell if cached data is stale
+    unsigned long getVersion() const;
+
+    // Bumped only when the walls ('#') on the grid change, which most rounds they do not
+    unsigned long getWallsVersion() const;
+
+    // Bumped only when the cells no tank can step on (walls '#' and mines '@') change, which is all a
+    // path over the grid depends on besides its ends
+    unsigned long getObstaclesVersion() const;
+
+    void updateGrid(const std::vector<Cell>& cells);
+
+    // Re-reads only the given indices of the row-major cell array, as listed by Board::getDirtyCells()
+    void updateCells(const std::vector<Cell>& cells, const std::vector<int>& dirtyCells);
 
     void initializeGrid(size_t height, size_t width);
 };
\ No newline at end of file
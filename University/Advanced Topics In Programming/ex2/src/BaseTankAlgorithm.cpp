@@ -1,5 +1,10 @@
 #include "BaseTankAlgorithm.h"
 
+bool BaseTankAlgorithm::debugOutput_ = true;
+thread_local std::ostream* BaseTankAlgorithm::debugStream_ = &std::cout;
+std::atomic<unsigned long> BaseTankAlgorithm::totalPathCacheHits_ = 0;
+std::atomic<unsigned long> BaseTankAlgorithm::totalPathCacheMisses_ = 0;
+
 // Constructor
 BaseTankAlgorithm::BaseTankAlgorithm(int player_index, int tank_index)
     : player_index_(player_index),
@@ -8,9 +13,22 @@ BaseTankAlgorithm::BaseTankAlgorithm(int player_index, int tank_index)
       ammo_(-1),
       pos_({-1, -1}),
       relevantInfo_(false),
-      grid_(),
+      grid_(std::make_shared<const std::vector<std::vector<char>>>()),
       enemy_positions_(),
-      lastShotCnt_(0)
+      lastShotCnt_(0),
+      distanceField_(nullptr),
+      sightTable_(nullptr),
+      threatMap_(nullptr),
+      obstaclesVersion_(0),
+      bfs_(),
+      path_(),
+      pathCached_(false),
+      pathFrom_({-1, -1}),
+      pathTo_({-1, -1}),
+      pathField_(nullptr),
+      pathObstaclesVersion_(0),
+      pathCacheHits_(0),
+      pathCacheMisses_(0)
 {
 }
 
@@ -28,17 +46,25 @@ void BaseTankAlgorithm::updateBattleInfo(BattleInfo& info) {
         if (getAmmo() == -1){
             setAmmo(num_shells);
         }
-        grid_ = baseInfo->getGrid();
-        findMyPos();
+        grid_ = baseInfo->getGridSnapshot();
+        distanceField_ = baseInfo->getDistanceField();
+        sightTable_ = baseInfo->getSightTable();
+        threatMap_ = baseInfo->getThreatMap();
+        obstaclesVersion_ = baseInfo->getObstaclesVersion();
+        pos_ = baseInfo->getMyPos();
+        if (pos_ == std::pair<int, int>(-1, -1)) {
+            findMyPos();
+        }
         findEnemyPositions();
     }
 }
 
 void BaseTankAlgorithm::findMyPos() {
+    const std::vector<std::vector<char>>& grid = getGrid();
     pos_ = {-1, -1}; // Reset position
-    for (size_t row = 0; row < grid_.size(); ++row) {
-        for (size_t col = 0; col < grid_[row].size(); ++col) {
-            if (grid_[row][col] == '%') {
+    for (size_t row = 0; row < grid.size(); ++row) {
+        for (size_t col = 0; col < grid[row].size(); ++col) {
+            if (grid[row][col] == '%') {
                 pos_ = {row, col};
                 return; // Exit early when found
             }
@@ -62,8 +88,9 @@ std::pair<int, int> BaseTankAlgorithm::getNextPos(const std::vector<std::pair<in
 }
 
 Direction BaseTankAlgorithm::getDirectionToward(pair<int, int> coords) {
-    int rows = grid_.size();
-    int cols = grid_[0].size();
+    const std::vector<std::vector<char>>& grid = getGrid();
+    int rows = grid.size();
+    int cols = grid[0].size();
 
     for (size_t i = 0; i < 8; ++i) {
         Direction dir = indexToDirection(i);
@@ -97,8 +124,9 @@ ActionRequest BaseTankAlgorithm::whichRotation(Direction desired_dir) {
 }
 
 bool BaseTankAlgorithm::canMoveForward() {
-    int rows = grid_.size();
-    int cols = grid_[0].size();
+    const std::vector<std::vector<char>>& grid = getGrid();
+    int rows = grid.size();
+    int cols = grid[0].size();
 
     // Get next position in the current direction
     pair<int, int> next_pos = getNextCoordsInDir(dir_, pos_, rows, cols);
@@ -109,26 +137,33 @@ bool BaseTankAlgorithm::canMoveForward() {
 
 
 bool BaseTankAlgorithm::isSafe(pair<int, int> pos) {
-    int rows = grid_.size();
-    int cols = grid_[0].size();
+    const std::vector<std::vector<char>>& grid = getGrid();
+    int rows = grid.size();
+    int cols = grid[0].size();
 
-    char c = grid_[pos.first][pos.second];
+    char c = grid[pos.first][pos.second];
 
     // Check if cell is an obstacle or a shell
     if (c == '@' || c == '*' || c == '#') {
         return false;  // Wall, mine, or shell
     }
 
+    // A single lookup with the threat map the player built for this grid, if the battle info came with one
+    if (threatMap_ && threatMap_->getRows() == rows && threatMap_->getColumns() == cols &&
+        threatMap_->getRange() >= ThreatMap::SAFETY_RANGE) {
+        return !threatMap_->threatened(pos, ThreatMap::SAFETY_RANGE);
+    }
+
     // Check if a shell might move into this position (next 2 turns)
     for (size_t i = 0; i < 8; ++i) {
         pair<int, int> neighbor1 = getNextCoordsInDir(indexToDirection(i), pos, rows, cols);
-        char c1 = grid_[neighbor1.first][neighbor1.second];
+        char c1 = grid[neighbor1.first][neighbor1.second];
         if (c1 == '*') {
             return false;  // Shell could reach here
         }
 
         pair<int, int> neighbor2 = getNextCoordsInDir(indexToDirection(i), neighbor1, rows, cols);
-        char c2 = grid_[neighbor2.first][neighbor2.second];
+        char c2 = grid[neighbor2.first][neighbor2.second];
         if (c2 == '*') {
             return false;  // Shell could reach here
         }
@@ -137,8 +172,9 @@ bool BaseTankAlgorithm::isSafe(pair<int, int> pos) {
 }
 
 bool BaseTankAlgorithm::canMoveBackward() {
-    int rows = grid_.size();
-    int cols = grid_[0].size();
+    const std::vector<std::vector<char>>& grid = getGrid();
+    int rows = grid.size();
+    int cols = grid[0].size();
 
     // Compute the opposite direction
     Direction opposite = rotateRightQuarter(rotateRightQuarter(dir_));
@@ -151,8 +187,13 @@ bool BaseTankAlgorithm::canMoveBackward() {
 }
 
 bool BaseTankAlgorithm::hasLineOfSight(pair<int, int> pos, Direction dir, pair<int, int> target_pos) {
-    int rows = grid_.size();
-    int cols = grid_[0].size();
+    const std::vector<std::vector<char>>& grid = getGrid();
+    int rows = grid.size();
+    int cols = grid[0].size();
+    // O(1) with the sight table the player built for this grid's walls, if the battle info came with one
+    if (sightTable_ && sightTable_->getRows() == rows && sightTable_->getColumns() == cols) {
+        return sightTable_->hasLineOfSight(pos, dir, target_pos);
+    }
     int maxSteps = max(rows, cols);
     pair<int, int> current_pos = pos;
 
@@ -164,7 +205,7 @@ bool BaseTankAlgorithm::hasLineOfSight(pair<int, int> pos, Direction dir, pair<i
             return true; // Found the target
         }
 
-        char cell = grid_[current_pos.first][current_pos.second];
+        char cell = grid[current_pos.first][current_pos.second];
         if (cell == '#') {
             return false; // Obstacle (wall) blocks line of sight
         }
@@ -187,10 +228,11 @@ ActionRequest BaseTankAlgorithm::findRotationForLineOfSight(pair<int, int> targe
 }
 
 void BaseTankAlgorithm::findEnemyPositions() {
+    const std::vector<std::vector<char>>& grid = getGrid();
     enemy_positions_.clear();  // Clear previous data
-    for (size_t row = 0; row < grid_.size(); ++row) {
-        for (size_t col = 0; col < grid_[row].size(); ++col) {
-            char cell = grid_[row][col];
+    for (size_t row = 0; row < grid.size(); ++row) {
+        for (size_t col = 0; col < grid[row].size(); ++col) {
+            char cell = grid[row][col];
             if (isdigit(cell)) {
                 int tankNum = cell - '0';
                 if (tankNum != player_index_) {
@@ -201,6 +243,38 @@ void BaseTankAlgorithm::findEnemyPositions() {
     }
 }
 
+const std::vector<std::pair<int, int>>& BaseTankAlgorithm::findPath(pair<int, int> target_pos) {
+    // A path read off a distance field only depends on the field and where it starts, and a BFS path on
+    // its ends and the walls and mines in between, so if none of those changed it would be found again
+    bool cached = pathCached_ && pathFrom_ == pos_;
+    if (distanceField_) {
+        cached = cached && pathField_ == distanceField_;
+    } else {
+        cached = cached && !pathField_ && pathTo_ == target_pos && obstaclesVersion_ != 0 &&
+            pathObstaclesVersion_ == obstaclesVersion_;
+    }
+    if (cached) {
+        pathCacheHits_++;
+        totalPathCacheHits_.fetch_add(1, std::memory_order_relaxed);
+        return path_;
+    }
+
+    pathCacheMisses_++;
+    totalPathCacheMisses_.fetch_add(1, std::memory_order_relaxed);
+    if (distanceField_) {
+        path_ = distanceField_->pathFrom(pos_);
+    } else {
+        bfs_.runBFS(pos_, target_pos, getGrid());
+        path_ = bfs_.getBFSPath();
+    }
+    pathCached_ = true;
+    pathFrom_ = pos_;
+    pathTo_ = target_pos;
+    pathField_ = distanceField_;
+    pathObstaclesVersion_ = obstaclesVersion_;
+    return path_;
+}
+
 void BaseTankAlgorithm::rotate(ActionRequest action){
     Direction newDirection = getDir();
 
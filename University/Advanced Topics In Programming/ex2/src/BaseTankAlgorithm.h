@@ -1,7 +1,11 @@
 #pragma once
 #include "TankAlgorithm.h"
 #include "BaseBattleInfo.h"
+#include "bfs.h"
 #include "direction.h"
+#include <atomic>
+#include <iostream>
+#include <memory>
 #include <vector>
 #include <utility>
 
@@ -13,9 +17,33 @@ protected:
     int ammo_;
     std::pair<int, int> pos_;
     bool relevantInfo_;
-    std::vector<std::vector<char>> grid_;
+    // Shared with the battle info it came in, and never written to
+    std::shared_ptr<const std::vector<std::vector<char>>> grid_;
     std::vector<std::pair<int, int>> enemy_positions_;
     int lastShotCnt_;
+    std::shared_ptr<const DistanceField> distanceField_;
+    std::shared_ptr<const SightTable> sightTable_;
+    std::shared_ptr<const ThreatMap> threatMap_;
+    unsigned long obstaclesVersion_;
+    // The last path found by findPath(), with what it was found from: it is only searched for again once
+    // one of those has changed
+    BFS bfs_;
+    std::vector<std::pair<int, int>> path_;
+    bool pathCached_;
+    std::pair<int, int> pathFrom_;
+    std::pair<int, int> pathTo_;
+    std::shared_ptr<const DistanceField> pathField_;
+    unsigned long pathObstaclesVersion_;
+    unsigned long pathCacheHits_;
+    unsigned long pathCacheMisses_;
+    // The same counts, summed over all tanks (of all games running at once)
+    static std::atomic<unsigned long> totalPathCacheHits_;
+    static std::atomic<unsigned long> totalPathCacheMisses_;
+    // Shared by all tanks: whether they print their reasoning (paths, warnings) to the console
+    static bool debugOutput_;
+    // Where the calling thread's tanks print it: the console, unless the game manager is collecting it
+    // while the tanks decide in parallel (see GameManager::setDecisionThreads)
+    static thread_local std::ostream* debugStream_;
 
 public:
     BaseTankAlgorithm(int player_index, int tank_index);
@@ -34,6 +62,9 @@ public:
     bool hasLineOfSight(pair<int, int> pos, Direction dir, pair<int, int> target_pos);
     ActionRequest findRotationForLineOfSight(pair<int, int> target_pos);
     void findEnemyPositions();
+    // The path from the tank's position to the nearest enemy, read from the player's distance field, or
+    // to the given target by a BFS of its own if the battle info came without one
+    const std::vector<std::pair<int, int>>& findPath(pair<int, int> target_pos);
 
     // Getters
     int getPlayerIndex() const { return player_index_; }
@@ -42,9 +73,19 @@ public:
     int getAmmo() const { return ammo_; }
     std::pair<int, int> getPos() const { return pos_; }
     bool getRelevantInfo() const { return relevantInfo_; }
-    std::vector<std::vector<char>> getGrid() const { return grid_; }
+    const std::vector<std::vector<char>>& getGrid() const { return *grid_; }
     std::vector<std::pair<int, int>> getEnemyPositions() const { return enemy_positions_; }
     int getLastShotCnt() const { return lastShotCnt_; }
+    const std::shared_ptr<const DistanceField>& getDistanceField() const { return distanceField_; }
+    const std::shared_ptr<const SightTable>& getSightTable() const { return sightTable_; }
+    const std::shared_ptr<const ThreatMap>& getThreatMap() const { return threatMap_; }
+    unsigned long getPathCacheHits() const { return pathCacheHits_; }
+    unsigned long getPathCacheMisses() const { return pathCacheMisses_; }
+    unsigned long getBfsRuns() const { return bfs_.getRuns(); }
+    static unsigned long getTotalPathCacheHits() { return totalPathCacheHits_; }
+    static unsigned long getTotalPathCacheMisses() { return totalPathCacheMisses_; }
+    static bool getDebugOutput() { return debugOutput_; }
+    static std::ostream& getDebugStream() { return *debugStream_; }
 
     // Setters
     void setPlayerIndex(int index) { player_index_ = index; }
@@ -53,7 +94,11 @@ public:
     void setAmmo(int ammo) { ammo_ = ammo; }
     void setPosition(std::pair<int, int> pos) { pos_ = pos; }
     void setRelevantInfo(bool info) { relevantInfo_ = info; }
-    void setGrid(const std::vector<std::vector<char>>& grid) { grid_ = grid; }
+    static void setDebugOutput(bool debug_output) { debugOutput_ = debug_output; }
+    static void setDebugStream(std::ostream& debug_stream) { debugStream_ = &debug_stream; }
+    void setGrid(const std::vector<std::vector<char>>& grid) {
+        grid_ = std::make_shared<const std::vector<std::vector<char>>>(grid);
+    }
     void setEnemyPositions(const std::vector<std::pair<int, int>>& enemies) { enemy_positions_ = enemies; }
     void resetLastShotCount(){ lastShotCnt_ = 4; }
     void decreaseLastShotCount() { if (lastShotCnt_ > 0){ lastShotCnt_ -= 1; } }
@@ -7,7 +7,8 @@ Player1::Player1(int player_index, size_t x, size_t y, size_t max_steps, size_t
 Player1::~Player1() = default;
 
 void Player1::updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satellite_view) {
-    std::vector<std::vector<char>> grid(getRows(), std::vector<char>(getColumns()));
+    /* Copying the grid, as the enemies we are not targeting are about to be hidden from it: */
+    std::vector<std::vector<char>> grid = *getGridSnapshot(satellite_view);
 
     /* Getting a new target: */
     // if (true) {
@@ -16,7 +17,6 @@ void Player1::updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satel
 
     for (size_t y = 0; y < getRows(); ++y) {
         for (size_t x = 0; x < getColumns(); ++x) {
-            grid[y][x] = satellite_view.getObjectAt(x, y);
             if (grid[y][x] == '1' || grid[y][x] == '%') { allied_coords.push_back(std::pair(y, x)); }
             else if (grid[y][x] == '2') { enemy_coords.push_back(std::pair(y, x)); }
         }
@@ -26,9 +26,11 @@ void Player1::updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satel
     double min_dis = getRows() + getColumns() + 1;
     for (const auto& ally : allied_coords) {
         for (const auto& enemy : enemy_coords) {
-            double dis = sqrt(pow(abs(ally.first - enemy.first), 2) + pow(abs(ally.second - enemy.second), 2));
+            int row_dis = abs(static_cast<int>(ally.first) - static_cast<int>(enemy.first));
+            int col_dis = abs(static_cast<int>(ally.second) - static_cast<int>(enemy.second));
+            double dis = sqrt(pow(row_dis, 2) + pow(col_dis, 2));
             if (dis < min_dis) {
-                min_dis = abs(ally.first - enemy.first) + abs(ally.second - enemy.second);
+                min_dis = row_dis + col_dis;
                 targetedEnemy_ = true;
                 targetPos_ = enemy;
             }
@@ -43,8 +45,13 @@ void Player1::updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satel
     }
 
     BaseBattleInfo battleInfo;
-    battleInfo.setGrid(grid);
+    battleInfo.setGrid(std::make_shared<const std::vector<std::vector<char>>>(std::move(grid)));
+    battleInfo.setMyPos(getCurrTankPos(satellite_view));
     battleInfo.setNumShells(getNumShells());
+    battleInfo.setDistanceField(getDistanceField(battleInfo.getGrid(), satellite_view));
+    battleInfo.setSightTable(getSightTable(battleInfo.getGrid(), satellite_view));
+    battleInfo.setThreatMap(getThreatMap(battleInfo.getGrid(), satellite_view));
+    battleInfo.setObstaclesVersion(getObstaclesVersion(satellite_view));
 
     tank.updateBattleInfo(battleInfo);
 }
\ No newline at end of file
@@ -14,7 +14,7 @@ ActionRequest TankAlgorithm1::getAction() {
     decreaseLastShotCount();
 
     if (getEnemyPositions().empty()) {
-        cout << "no enemies" << endl;
+        if (getDebugOutput()) { getDebugStream() << "no enemies" << '\n'; }
         return ActionRequest::GetBattleInfo;
     }
 
@@ -34,21 +34,20 @@ ActionRequest TankAlgorithm1::getAction() {
         return rotation;
     }
 
-    // Step 3: BFS path to target using grid
-    BFS bfs;
-    vector<vector<char>> grid = getGrid();
-    bfs.initializeBFSVertices(grid);
-    bfs.runBFS(getPos(), target_pos, grid);
+    // Step 3: Path to target, only searched for again once we, the target or the obstacles have moved
+    const vector<vector<char>>& grid = getGrid();
+    const vector<pair<int, int>>& path = findPath(target_pos);
 
-    const auto& path = bfs.getBFSPath();
-    std::cout << "BFS Path: ";
-    for (const auto& pos : path) {
-        std::cout << "(" << pos.first << "," << pos.second << ") ";
+    if (getDebugOutput()) {
+        getDebugStream() << "BFS Path: ";
+        for (const auto& pos : path) {
+            getDebugStream() << "(" << pos.first << "," << pos.second << ") ";
+        }
+        getDebugStream() << '\n';
     }
-    std::cout << std::endl;
-    if (bfs.pathExists() && !bfs.getBFSPath().empty()) {
-        if (isPathSafe(bfs.getBFSPath())) {
-            pair<int, int> next = getNextPos(bfs.getBFSPath());
+    if (!path.empty()) {
+        if (isPathSafe(path)) {
+            pair<int, int> next = getNextPos(path);
             Direction desired_dir = getDirectionToward(next);
             if (getDir() != desired_dir) {
                 ActionRequest rotation = whichRotation(desired_dir);
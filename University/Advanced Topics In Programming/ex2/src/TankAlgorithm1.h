@@ -1,6 +1,5 @@
 #pragma once
 #include "BaseTankAlgorithm.h"
-#include "bfs.h"
 
 class TankAlgorithm1 : public BaseTankAlgorithm {
 public:
@@ -15,7 +15,7 @@ ActionRequest TankAlgorithm2::getAction() {
 
     if (getEnemyPositions().empty()) {
         // No enemies found, fallback action
-        cout << "no enemies" << endl;
+        if (getDebugOutput()) { getDebugStream() << "no enemies" << '\n'; }
         return ActionRequest::DoNothing;
     }
 
@@ -56,7 +56,7 @@ ActionRequest TankAlgorithm2::getAction() {
 
     // Emergency handling if standing on unsafe tile
     if (!isSafe(getPos())) {
-        cout << "I'm in danger!" << endl;
+        if (getDebugOutput()) { getDebugStream() << "I'm in danger!" << '\n'; }
 
         // Try to move forward if safe
         if (canMoveForward()) {
@@ -64,8 +64,8 @@ ActionRequest TankAlgorithm2::getAction() {
         }
 
         // Try all adjacent cells to find a safe one and rotate/move there
-        int rows = grid_.size();
-        int cols = grid_[0].size();
+        int rows = getGrid().size();
+        int cols = getGrid()[0].size();
 
         for (int i = 0; i < 8; ++i) {
             Direction adj_dir = indexToDirection(i);
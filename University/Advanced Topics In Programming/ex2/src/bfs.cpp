@@ -12,88 +12,17 @@ using namespace std;
 
 BFS::BFS() {
     BFSPath_ = vector<pair<int, int>>();
-    BFSVertices_ = vector<BFS_Vertex>();
-    Q_ = vector<BFS_Vertex>();
-    S_ = BFS_Vertex();
-    V_ = BFS_Vertex();
+    generation_ = 0;
+    rows_ = 0;
+    columns_ = 0;
+    S_ = {0, 0};
+    V_ = {0, 0};
     pathExists_ = false;
+    runs_ = 0;
 }
 
-BFS::BFS(int spaces) {
-    BFSPath_ = vector<pair<int, int>>();
-    BFSPath_.reserve(spaces);
-    BFSVertices_ = vector<BFS_Vertex>();
-    BFSVertices_.reserve(spaces);
-    Q_ = vector<BFS_Vertex>();
-    Q_.reserve(spaces);
-    S_ = BFS_Vertex();
-    V_ = BFS_Vertex();
-    pathExists_ = false;
-}
-
-BFS::BFS(const vector<pair<int, int>> bfs_path, const vector<BFS_Vertex> bfs_vertices,
-    const vector<BFS_Vertex> Q, BFS_Vertex S, BFS_Vertex V, bool path_exists) {
-        BFSPath_ = bfs_path;
-        BFSVertices_ = bfs_vertices;
-        Q_ = Q;
-        S_ = S;
-        V_ = V;
-        pathExists_ = path_exists;
-    }
-
-BFS::BFS(const BFS& bfs) {
-    BFSPath_ = bfs.getBFSPath();
-    BFSVertices_ = bfs.getBFSVertices();
-    Q_ = bfs.getQ();
-    S_ = bfs.getS();
-    V_ = bfs.getV();
-    pathExists_ = bfs.pathExists();
-}
-
-BFS::BFS(BFS&& bfs) noexcept {
-    BFSPath_ = bfs.getBFSPath();
-    BFSVertices_ = bfs.getBFSVertices();
-    Q_ = bfs.getQ();
-    S_ = bfs.getS();
-    V_ = bfs.getV();
-    pathExists_ = bfs.pathExists();
-    bfs.resetBFS();
-}
-
-/* -------------------------------------------- OPERATORS: ------------------------------------------- */
-
-BFS& BFS::operator=(const BFS& bfs) {
-    if (this != &bfs) {
-        BFSPath_ = bfs.getBFSPath();
-        BFSVertices_ = bfs.getBFSVertices();
-        Q_ = bfs.getQ();
-        S_ = bfs.getS();
-        V_ = bfs.getV();
-        pathExists_ = bfs.pathExists();
-    }
-    return *this;
-}
-
-BFS& BFS::operator=(BFS&& bfs) noexcept {
-    if (this != &bfs) {
-        BFSPath_ = bfs.getBFSPath();
-        BFSVertices_ = bfs.getBFSVertices();
-        Q_ = bfs.getQ();
-        S_ = bfs.getS();
-        V_ = bfs.getV();
-        pathExists_ = bfs.pathExists();
-        bfs.resetBFS();
-    }
-    return *this;
-}
-
-bool BFS::operator==(const BFS& bfs) const {
-    return (BFSPath_ == bfs.getBFSPath() && BFSVertices_ == bfs.getBFSVertices() && Q_ == bfs.getQ() &&
-            S_ == bfs.getS() && V_ == bfs.getV() && pathExists_ == bfs.pathExists());
-}
-
-bool BFS::operator!=(const BFS& bfs) const {
-    return !(*this == bfs);
+BFS::BFS(int rows, int columns) : BFS() {
+    initialize(rows, columns);
 }
 
 /* --------------------------------------------- GETTERS: -------------------------------------------- */
@@ -102,19 +31,11 @@ const vector<pair<int, int>>& BFS::getBFSPath() const {
     return BFSPath_;
 }
 
-const  vector<BFS_Vertex>& BFS::getBFSVertices() const {
-    return BFSVertices_;
-}
-
-const  vector<BFS_Vertex>& BFS::getQ() const {
-    return Q_;
-}
-
-BFS_Vertex BFS::getS() const {
+pair<int, int> BFS::getS() const {
     return S_;
 }
 
-BFS_Vertex BFS::getV() const {
+pair<int, int> BFS::getV() const {
     return V_;
 }
 
@@ -122,157 +43,141 @@ bool BFS::pathExists() const {
     return pathExists_;
 }
 
-/* --------------------------------------------- SETTERS: -------------------------------------------- */
-
-void BFS::setBFSPath(const vector<pair<int, int>>& bfs_path) {
-    BFSPath_ = bfs_path;
-}
-
-void BFS::setBFSVertices(const vector<BFS_Vertex>& bfs_vertices) {
-    BFSVertices_ = bfs_vertices;
-}
-
-void BFS::setQ(const vector<BFS_Vertex>& Q) {
-    Q_ = Q;
-}
-
-void BFS::setS(BFS_Vertex S) {
-    S_ = S;
-}
-
-void BFS::setV(BFS_Vertex V) {
-    V_ = V;
+int BFS::getDis(pair<int, int> pos) const {
+    int index = pos.first * columns_ + pos.second;
+    if (index < 0 || index >= static_cast<int>(visited_.size()) || visited_[index] != generation_) {
+        return -1;
+    }
+    return dis_[index];
 }
 
-void BFS::setPathExistance(bool path_exists) {
-    pathExists_ = path_exists;
+unsigned long BFS::getRuns() const {
+    return runs_;
 }
 
 /* ----------------------------------------- OTHER FUNCTIONS: ---------------------------------------- */
 
-void BFS::initializeBFSVertices(const std::vector<std::vector<char>>& grid) {
-    BFSVertices_.clear();  // Clear any previous vertices
-    int rows = grid.size();
-    int cols = grid.empty() ? 0 : grid[0].size();
-
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < cols; ++j) {
-            BFS_Vertex vertex({i, j});
-            BFSVertices_.push_back(vertex);
-        }
-    }
-}
-
-void BFS::addBFSVertex(BFS_Vertex bfs_vertex) {
-    BFSVertices_.push_back(bfs_vertex);
-}
-
-void BFS::updateBFSFields(pair<int, int> S_pos, pair<int, int> V_pos) {
+void BFS::initialize(int rows, int columns) {
+    if (rows == rows_ && columns == columns_) { return; }
+    rows_ = rows;
+    columns_ = columns;
+    size_t cells = static_cast<size_t>(rows) * columns;
+    dis_.assign(cells, 0);
+    parent_.assign(cells, -1);
+    visited_.assign(cells, 0);
+    onPath_.assign(cells, 0);
+    Q_.assign(cells, 0);
+    blocked_.assign(cells, 0);
+    neighbors_ = NeighborTable::getShared(rows, columns);
     BFSPath_.clear();
-    Q_.clear();
-    for (BFS_Vertex bfs_vertex : BFSVertices_) {
-        bfs_vertex.setHasParent(false);
-        if (bfs_vertex.getVertexPos() == S_pos) {
-            bfs_vertex.setColor("gray");
-            bfs_vertex.setDis(0);
-            S_ = bfs_vertex;
-            Q_.push_back(S_);
-        }
-        else {
-            bfs_vertex.setColor("white");
-            bfs_vertex.setDis(numeric_limits<double>::infinity());
-            if (bfs_vertex.getVertexPos() == V_pos) { V_ = bfs_vertex; }
-        }
-    }
-    pathExists_ = false;
+    BFSPath_.reserve(rows + columns);
+    generation_ = 0;
 }
 
 void BFS::reconstructBFSPath() {
     BFSPath_.clear();
-    auto it = find_if(BFSVertices_.begin(), BFSVertices_.end(), [this](const BFS_Vertex& bfs_vertex)
-        { return bfs_vertex.getVertexPos() == V_.getVertexPos(); });
-    if (it == BFSVertices_.end() || !it->hasParent()) { /* No path exists. */
+    int source = S_.first * columns_ + S_.second;
+    int target = V_.first * columns_ + V_.second;
+    if (visited_[target] != generation_ || parent_[target] == -1) { /* No path exists. */
         pathExists_ = false;
         return;
     }
-    BFS_Vertex current = *it;
-    while (current.getVertexPos() != S_.getVertexPos()) {
-        BFSPath_.push_back(current.getVertexPos());
-        auto parent_it = find_if(BFSVertices_.begin(), BFSVertices_.end(),
-            [&current](const BFS_Vertex& bfs_vertex)
-            { return bfs_vertex.getVertexPos() == current.getParentPos(); });
-        if (parent_it == BFSVertices_.end()) {  /* Path reconstruction failed. */
-            pathExists_ = false;
-            break;
-        }
-        current = *parent_it;
+    for (int current = target; current != source; current = parent_[current]) {
+        BFSPath_.push_back({current / columns_, current % columns_});
+        onPath_[current] = generation_;
     }
-    BFSPath_.push_back(S_.getVertexPos());
+    BFSPath_.push_back(S_);
+    onPath_[source] = generation_;
     reverse(BFSPath_.begin(), BFSPath_.end());
     pathExists_ = !BFSPath_.empty();  // Ensure pathExists_ is set correctly
 }
 
 void BFS::runBFS(pair<int, int> S_pos, pair<int, int> V_pos,
     const vector<vector<char>>& grid) {
-    updateBFSFields(S_pos, V_pos);
-    int rows = grid.size();
-    int cols = grid[0].size();
+    runs_++;
+    initialize(grid.size(), grid.empty() ? 0 : grid[0].size());
+    BFSPath_.clear();
+    pathExists_ = false;
+    S_ = S_pos;
+    V_ = V_pos;
+    if (++generation_ == 0) {   /* The stamps wrapped around, so older stamps must be forgotten. */
+        fill(visited_.begin(), visited_.end(), 0);
+        fill(onPath_.begin(), onPath_.end(), 0);
+        generation_ = 1;
+    }
+
+    auto inBoard = [this](pair<int, int> pos) {
+        return pos.first >= 0 && pos.first < rows_ && pos.second >= 0 && pos.second < columns_;
+    };
+    if (!inBoard(S_pos) || !inBoard(V_pos)) { return; }
+
+    /* Walls '#' and mines '@' are read off the grid into a flat array once, rather than looked up by
+     * coordinates for every neighbor of every expanded cell. */
+    unsigned char* blocked = blocked_.data();
+    for (int row = 0; row < rows_; row++) {
+        const char* line = grid[row].data();
+        for (int col = 0; col < columns_; col++) {
+            *blocked++ = (line[col] == '#' || line[col] == '@');
+        }
+    }
+
+    int source = S_pos.first * columns_ + S_pos.second;
+    int target = V_pos.first * columns_ + V_pos.second;
+    size_t head = 0;
+    size_t tail = 0;
+    visited_[source] = generation_;
+    dis_[source] = 0;
+    parent_[source] = -1;
+    Q_[tail++] = source;
 
-    while (!Q_.empty()) {
-        BFS_Vertex u = Q_.front();
-        Q_.erase(Q_.begin());
+    /* Every cell is pushed at most once per search, so the queue buffer never needs to wrap. */
+    while (head < tail) {
+        int u = Q_[head++];
 
-        if (u.getVertexPos() == V_pos) {
-            pathExists_ = true;
+        if (u == target) {
             reconstructBFSPath();
             break;
         }
 
-        // Explore neighbors using 8 directions
+        // Explore neighbors using 8 directions, skipping walls '#' and mines '@'
+        const int* neighbors = neighbors_->getNeighbors(u);
         for (int dir_idx = 0; dir_idx < 8; dir_idx++) {
-            Direction dir = indexToDirection(dir_idx);
-            pair<int, int> neighbor = getNextCoordsInDir(dir, u.getVertexPos(), rows, cols);
-
-            // Skip walls '#' and mines '@'
-            if (grid[neighbor.first][neighbor.second] == '#' ||
-                grid[neighbor.first][neighbor.second] == '@') {
+            int v = neighbors[dir_idx];
+            if (blocked_[v]) {
                 continue;
             }
 
-            auto it = find_if(BFSVertices_.begin(), BFSVertices_.end(),
-                [&neighbor](const BFS_Vertex& bfs_vertex)
-                { return bfs_vertex.getVertexPos() == neighbor; });
-
-            if (it != BFSVertices_.end() && it->getColor() == "white") {
-                it->setColor("gray");
-                it->setDis(u.getDis() + 1);
-                it->setParentPos(u.getVertexPos());
-                it->setHasParent(true);
-                Q_.push_back(*it);
+            if (visited_[v] != generation_) {
+                visited_[v] = generation_;
+                dis_[v] = dis_[u] + 1;
+                parent_[v] = u;
+                Q_[tail++] = v;
             }
         }
-
-        auto it = find_if(BFSVertices_.begin(), BFSVertices_.end(),
-            [&u](const BFS_Vertex& bfs_vertex)
-            { return bfs_vertex.getVertexPos() == u.getVertexPos(); });
-        if (it != BFSVertices_.end()) {
-            it->setColor("black");
-        }
     }
 }
 
-bool BFS::isOnPath(pair<int, int> pos) {
-    return find(BFSPath_.begin(), BFSPath_.end(), pos) != BFSPath_.end();
+bool BFS::isOnPath(pair<int, int> pos) const {
+    int index = pos.first * columns_ + pos.second;
+    return pathExists_ && index >= 0 && index < static_cast<int>(onPath_.size()) &&
+        onPath_[index] == generation_;
 }
 
 void BFS::resetBFS() noexcept {
     BFSPath_.clear();
     vector<pair<int, int>>().swap(BFSPath_);
-    BFSVertices_.clear();
-    vector<BFS_Vertex>().swap(BFSVertices_);
-    Q_.clear();
-    vector<BFS_Vertex>().swap(Q_);
-    S_.resetBFSVertex();
-    V_.resetBFSVertex();
+    vector<int>().swap(dis_);
+    vector<int>().swap(parent_);
+    vector<unsigned>().swap(visited_);
+    vector<unsigned>().swap(onPath_);
+    vector<int>().swap(Q_);
+    vector<unsigned char>().swap(blocked_);
+    neighbors_.reset();
+    generation_ = 0;
+    rows_ = 0;
+    columns_ = 0;
+    S_ = {0, 0};
+    V_ = {0, 0};
     pathExists_ = false;
-}
\ No newline at end of file
+    runs_ = 0;
+}
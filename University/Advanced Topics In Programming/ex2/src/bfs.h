@@ -5,94 +5,79 @@
  */
 
 #pragma once
-#include <map>
 #include <iostream>
-#include <limits>
-#include "bfs_vertex.h"
 #include "direction.h"
+#include "neighbor_table.h"
+#include <memory>
 #include <vector>
 using namespace std;
 
 
+/** A breadth-first search over the toroidal board. All the per-cell bookkeeping lives in flat arrays
+ * indexed by row * columns + col, which are allocated once and reused by every search: a cell's distance
+ * and parent are only valid if its visit stamp matches the current generation, so starting a new search
+ * never has to clear them. Cells are expanded through the NeighborTable shared by every search on a
+ * board of the same dimensions (see NeighborTable::getShared()). */
 class BFS {
     private:
         std::vector<std::pair<int, int>> BFSPath_;
-        std::vector<BFS_Vertex> BFSVertices_;
-        std::vector<BFS_Vertex> Q_;
-        BFS_Vertex S_;
-        BFS_Vertex V_;
+        std::vector<int> dis_;
+        std::vector<int> parent_;
+        std::vector<unsigned> visited_;
+        std::vector<unsigned> onPath_;
+        std::vector<int> Q_;
+        std::vector<unsigned char> blocked_;
+        std::shared_ptr<const NeighborTable> neighbors_;
+        unsigned generation_;
+        int rows_;
+        int columns_;
+        std::pair<int, int> S_;
+        std::pair<int, int> V_;
         bool pathExists_;
+        unsigned long runs_;
 
     public:
         /* -------------------------------------- CONSTRUCTORS: -------------------------------------- */
 
         /** Default Constructor. */
         BFS();
-        /** Constructs a new BFS-type object while reserving the given number of spaces for each of the
-         * vectors this object has. */
-        BFS(int spaces);
-        /** Constructor with values for all fields. */
-        BFS(const std::vector<std::pair<int, int>> bfs_path, const std::vector<BFS_Vertex> bfs_vertices,
-            const std::vector<BFS_Vertex> Q, BFS_Vertex S, BFS_Vertex V, bool path_exists);
+        /** Constructs a new BFS-type object with buffers sized for a board of the given dimensions. */
+        BFS(int rows, int columns);
         /** Default Copy Constructor. */
-        BFS(const BFS& bfs);
+        BFS(const BFS& bfs) = default;
         /** Default Move Constructor. */
-        BFS(BFS&& bfs) noexcept;
+        BFS(BFS&& bfs) noexcept = default;
         /** Default Deconstructor. */
         ~BFS() = default;
 
         /* ---------------------------------------- OPERATORS: --------------------------------------- */
 
         /** Default Assignment Operator. */
-        BFS& operator=(const BFS& bfs);
+        BFS& operator=(const BFS& bfs) = default;
         /** Default Move Assignment Operator. */
-        BFS& operator=(BFS&& bfs) noexcept;
-        /** Default Equality Operator. */
-        bool operator==(const BFS& bfs) const;
-        /** Default Inequality Operator. */
-        bool operator!=(const BFS& bfs) const;
+        BFS& operator=(BFS&& bfs) noexcept = default;
 
         /* ----------------------------------------- GETTERS: ---------------------------------------- */
 
         /** Gets the vector of (X, Y) coordinated depicting the BFS path found between tankA's and
          * tankB's positions upon starting the BFS. */
         const std::vector<std::pair<int, int>>& getBFSPath() const;
-        /** Gets the vector of BFS vertices depicting all the board's vertices as BFS vertices. */
-        const std::vector<BFS_Vertex>& getBFSVertices() const;
-        /** Gets the vector of BFS vertices depicting the current BFS queue. */
-        const std::vector<BFS_Vertex>& getQ() const;
-        /** Gets the BFS vertex depicting tankA's position upon starting the BFS. */
-        BFS_Vertex getS() const;
-        /** Gets the BFS vertex depicting tankB's position upon starting the BFS. */
-        BFS_Vertex getV() const;
+        /** Gets the (X, Y) coordinates of tankA's position upon starting the BFS. */
+        std::pair<int, int> getS() const;
+        /** Gets the (X, Y) coordinates of tankB's position upon starting the BFS. */
+        std::pair<int, int> getV() const;
         /** Checks if a BFS path exists betwenn tankA's and tankB's position upon starting the BFS. */
         bool pathExists() const;
-
-        /* ----------------------------------------- SETTERS: ---------------------------------------- */
-
-        /** Sets the vector of (X, Y) coordinated depicting the BFS path found between tankA's and
-         * tankB's positions upon starting the BFS to the given one. */
-        void setBFSPath(const std::vector<std::pair<int, int>>& bfs_path);
-        /** Sets the vector of BFS vertices depicting all the board's vertices as BFS vertices to the
-         * given one. */
-        void setBFSVertices(const std::vector<BFS_Vertex>& bfs_vertices);
-        /** Sets the vector of BFS vertices depicting the current BFS queue to the given one. */
-        void setQ(const std::vector<BFS_Vertex>& Q);
-        /** Sets the BFS vertex depicting tankA's position upon starting the BFS to the given one. */
-        void setS(BFS_Vertex S);
-        /** Sets the BFS vertex depicting tankB's position upon starting the BFS to the given one. */
-        void setV(BFS_Vertex V);
-        /** Sets the BFS path's existance status to the given one. */
-        void setPathExistance(bool path_exists);
+        /** Gets the distance from tankA's position upon starting the last BFS to the given (X, Y)
+         * coordinates, or -1 if the last BFS has not reached them. */
+        int getDis(std::pair<int, int> pos) const;
+        /** Gets the number of times runBFS() was called since the object was constructed or reset. */
+        unsigned long getRuns() const;
 
         /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
-        
-        void initializeBFSVertices(const std::vector<std::vector<char>>& grid);
-        /** Adds a singular already existing BFS vertex to the vector of BFS vertices depicting all the
-         * board's vertices as BFS vertices */
-        void addBFSVertex(BFS_Vertex bfs_vertex);
-        /** Updates the BFS fields according to the given input. */
-        void updateBFSFields(std::pair<int, int> S_pos, std::pair<int, int> V_pos);
+
+        /** Sizes the BFS buffers for a board of the given dimensions. Does nothing if they already fit. */
+        void initialize(int rows, int columns);
         /** Reconstructs the BFS path (in (X, Y) coordinates) between tankA's and tankB's positions upon
          * starting the BFS. */
         void reconstructBFSPath();
@@ -100,7 +85,7 @@ class BFS {
         void runBFS(std::pair<int, int> S_pos, std::pair<int, int> V_pos,
             const vector<vector<char>>& grid);
         /** Checks if a singular (X, Y) coordinate is on the BFS path. */
-        bool isOnPath(std::pair<int, int> pos);
+        bool isOnPath(std::pair<int, int> pos) const;
         /** Resets the BFS-type object. */
         void resetBFS() noexcept;
-};
\ No newline at end of file
+};
@@ -0,0 +1,50 @@
+/**
+ * @file binary_io.h
+ * @brief A file containing the functions reading and writing integers in binary files.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+
+/** Fixed-width little-endian integers, written byte by byte so that a file reads the same on every
+ * machine. Reading past the end of the stream throws a runtime_error. */
+namespace BinaryIO {
+    /** Writes the lowest given number of bytes of the given value, lowest byte first. */
+    inline void writeBytes(std::ostream& out, std::uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) { out.put(static_cast<char>((value >> (8 * i)) & 0xFF)); }
+    }
+
+    /** Reads the given number of bytes written by writeBytes(). */
+    inline std::uint64_t readBytes(std::istream& in, int bytes) {
+        std::uint64_t value = 0;
+        for (int i = 0; i < bytes; ++i) {
+            int byte = in.get();
+            if (byte == std::istream::traits_type::eof()) {
+                throw std::runtime_error("Unexpected end of binary file");
+            }
+            value |= static_cast<std::uint64_t>(byte) << (8 * i);
+        }
+        return value;
+    }
+
+    inline void writeUint8(std::ostream& out, std::uint8_t value) { writeBytes(out, value, 1); }
+    inline void writeUint32(std::ostream& out, std::uint32_t value) { writeBytes(out, value, 4); }
+    inline void writeUint64(std::ostream& out, std::uint64_t value) { writeBytes(out, value, 8); }
+    /** Writes a signed integer as its two's complement 32 bits. */
+    inline void writeInt32(std::ostream& out, std::int32_t value) {
+        writeBytes(out, static_cast<std::uint32_t>(value), 4);
+    }
+
+    inline std::uint8_t readUint8(std::istream& in) {
+        return static_cast<std::uint8_t>(readBytes(in, 1));
+    }
+    inline std::uint32_t readUint32(std::istream& in) {
+        return static_cast<std::uint32_t>(readBytes(in, 4));
+    }
+    inline std::uint64_t readUint64(std::istream& in) { return readBytes(in, 8); }
+    inline std::int32_t readInt32(std::istream& in) { return static_cast<std::int32_t>(readUint32(in)); }
+}
@@ -5,17 +5,26 @@
  */
 
 #include "board.h"
+#include "zobrist.h"
+#include "binary_io.h"
 #include <algorithm>
 using namespace std;
 
+/** Writes the given vertex's wall, mine and HP attributes into the given cell. */
+static void writeVertex(Cell& cell, const Vertex& vertex) {
+    cell &= ~(CellFlag::WALL | CellFlag::MINE);
+    if (vertex.isWall()) { cell |= CellFlag::WALL; }
+    if (vertex.isMine()) { cell |= CellFlag::MINE; }
+    setCellWallHP(cell, vertex.getHP());
+}
+
 /* ------------------------------------------ CONSTRUCTORS: ------------------------------------------ */
 
 Board::Board() {
     rows_ = 0;
     columns_ = 0;
-    grid_ = vector<vector<string>>();
-    vertices_ = map<pair<int, int>, Vertex>();
-    shells_ = vector<Shell>();
+    cells_ = vector<Cell>();
+    shells_ = ShellPool();
     tanks_ = vector<Tank>();
     playerATanks_ = 0;
     playerBTanks_ = 0;
@@ -25,42 +34,42 @@ Board::Board(int rows, int columns) {
     rows_ = rows;
     columns_ = columns;
 
-    grid_.resize(rows_);
-    for (int i = 0; i < rows_; ++i) {
-        grid_[i].resize(columns_, ".");
-    }
+    cells_.assign(static_cast<size_t>(rows_) * columns_, CellFlag::EMPTY);
 
-    vertices_ = map<pair<int, int>, Vertex>();
-    shells_ = vector<Shell>();
+    shells_ = ShellPool();
     tanks_ = vector<Tank>();
     playerATanks_ = 0;
     playerBTanks_ = 0;
 }
 
-Board::Board(int rows, int columns, const vector<vector<string>>& grid,
-    const map<pair<int, int>, Vertex>& vertices, const vector<Shell>& shells ) {
+Board::Board(int rows, int columns, const vector<Cell>& cells, const ShellPool& shells ) {
         rows_ = rows;
         columns_ = columns;
-        grid_ = grid;
-        vertices_ = vertices;
+        cells_ = cells;
         shells_ = shells;
+        hashStale_ = true;
+        markAllDirty();
     }
 
-Board::Board(const Board& board) {
-    rows_ = board.getRows();
-    columns_ = board.getColumns();
-    grid_ = board.getGrid();
-    vertices_ = board.getVertices();
-    shells_ = board.getShells();
-    // bfs_ = board.getBFS();
-}
-
-Board::Board(Board&& board) noexcept {
-    rows_ = board.getRows();
-    columns_ = board.getColumns();
-    grid_ = board.getGrid();
-    vertices_ = board.getVertices();
-    shells_ = board.getShells();
+Board::Board(const Board& board)
+    : rows_(board.rows_), columns_(board.columns_), cells_(board.cells_), shells_(board.shells_),
+      tanks_(board.tanks_), playerATanks_(board.playerATanks_), playerBTanks_(board.playerBTanks_),
+      dirtyCells_(board.dirtyCells_), cellMarks_(board.cellMarks_), consoleOutput_(board.consoleOutput_),
+      trackDirtyCells_(board.trackDirtyCells_), cellsHash_(board.cellsHash_), tanksHash_(board.tanksHash_),
+      hashPendingCells_(board.hashPendingCells_), hashStale_(board.hashStale_) {}
+
+Board::Board(Board&& board) noexcept
+    : rows_(board.rows_), columns_(board.columns_), cells_(std::move(board.cells_)),
+      shells_(std::move(board.shells_)), tanks_(std::move(board.tanks_)),
+      playerATanks_(board.playerATanks_), playerBTanks_(board.playerBTanks_),
+      shellKeys_(std::move(board.shellKeys_)), shellKeyCounts_(std::move(board.shellKeyCounts_)),
+      tankAt_(std::move(board.tankAt_)),
+      nextTankAt_(std::move(board.nextTankAt_)), threadPool_(board.threadPool_),
+      minParallelShells_(board.minParallelShells_),
+      dirtyCells_(std::move(board.dirtyCells_)),
+      cellMarks_(std::move(board.cellMarks_)), consoleOutput_(board.consoleOutput_),
+      trackDirtyCells_(board.trackDirtyCells_), cellsHash_(board.cellsHash_), tanksHash_(board.tanksHash_),
+      hashPendingCells_(std::move(board.hashPendingCells_)), hashStale_(board.hashStale_) {
     board.resetBoard();
 }
 
@@ -68,30 +77,55 @@ Board::Board(Board&& board) noexcept {
 
 Board& Board::operator=(const Board& board) {
     if (this != &board) {
-        rows_ = board.getRows();
-        columns_ = board.getColumns();
-        grid_ = board.getGrid();
-        vertices_ = board.getVertices();
-        shells_ = board.getShells();
+        rows_ = board.rows_;
+        columns_ = board.columns_;
+        cells_ = board.cells_;
+        shells_ = board.shells_;
+        tanks_ = board.tanks_;
+        playerATanks_ = board.playerATanks_;
+        playerBTanks_ = board.playerBTanks_;
+        dirtyCells_ = board.dirtyCells_;
+        cellMarks_ = board.cellMarks_;
+        consoleOutput_ = board.consoleOutput_;
+        trackDirtyCells_ = board.trackDirtyCells_;
+        cellsHash_ = board.cellsHash_;
+        tanksHash_ = board.tanksHash_;
+        hashPendingCells_ = board.hashPendingCells_;
+        hashStale_ = board.hashStale_;
     }
     return *this;
 }
 
 Board& Board::operator=(Board&& board) noexcept {
     if (this != &board) {
-        rows_ = board.getRows();
-        columns_ = board.getColumns();
-        grid_ = board.getGrid();
-        vertices_ = board.getVertices();
-        shells_ = board.getShells();
+        rows_ = board.rows_;
+        columns_ = board.columns_;
+        cells_ = std::move(board.cells_);
+        shells_ = std::move(board.shells_);
+        tanks_ = std::move(board.tanks_);
+        playerATanks_ = board.playerATanks_;
+        playerBTanks_ = board.playerBTanks_;
+        shellKeys_ = std::move(board.shellKeys_);
+        shellKeyCounts_ = std::move(board.shellKeyCounts_);
+        tankAt_ = std::move(board.tankAt_);
+        nextTankAt_ = std::move(board.nextTankAt_);
+        dirtyCells_ = std::move(board.dirtyCells_);
+        cellMarks_ = std::move(board.cellMarks_);
+        consoleOutput_ = board.consoleOutput_;
+        trackDirtyCells_ = board.trackDirtyCells_;
+        cellsHash_ = board.cellsHash_;
+        tanksHash_ = board.tanksHash_;
+        hashPendingCells_ = std::move(board.hashPendingCells_);
+        hashStale_ = board.hashStale_;
         board.resetBoard();
     }
     return *this;
 }
 
 bool Board::operator==(const Board& board) const {
-    return (rows_ == board.getRows() && columns_ == board.getColumns() && grid_ == board.getGrid() &&
-        vertices_ == board.getVertices() &&  shells_ == board.getShells());
+    return (rows_ == board.getRows() && columns_ == board.getColumns() && cells_ == board.getCells() &&
+        shells_ == board.getShells() && tanks_ == board.tanks_ && playerATanks_ == board.getPlayerATanks() &&
+        playerBTanks_ == board.getPlayerBTanks());
 }
 
 bool Board::operator!=(const Board& board) const {
@@ -108,23 +142,28 @@ int Board::getColumns() const {
     return columns_;
 }
 
-const vector<vector<string>>& Board::getGrid() const {
-    return grid_;
+const vector<Cell>& Board::getCells() const {
+    return cells_;
+}
+
+Cell Board::getCell(pair<int, int> pos) const {
+    return cells_[cellIndex(pos)];
 }
 
-vector<vector<string>>& Board::getGrid() {
-    return grid_;
+int Board::cellIndex(pair<int, int> pos) const {
+    return pos.first * columns_ + pos.second;
 }
 
-const map<pair<int, int>, Vertex>& Board::getVertices() const {
-    return vertices_;
+Vertex Board::getVertex(pair<int, int> pos) const {
+    Cell cell = getCell(pos);
+    return Vertex(pos.first, pos.second, cellWallHP(cell), cell & CellFlag::WALL, cell & CellFlag::MINE);
 }
 
-const vector<Shell>& Board::getShells() const {
+const ShellPool& Board::getShells() const {
     return shells_;
 }
 
-vector<Shell>& Board::getShells() {
+ShellPool& Board::getShells() {
     return shells_;
 }
 
@@ -146,29 +185,125 @@ void Board::setColumns(int columns) {
     columns_ = columns;
 }
 
-void Board::setGrid(const vector<vector<string>>& grid) {
-    grid_ = grid;
+void Board::setCells(const vector<Cell>& cells) {
+    cells_ = cells;
+    hashStale_ = true;
+    markAllDirty();
 }
 
-void Board::setVertices(const map<pair<int, int>, Vertex>& vertices) {
-    vertices_ = vertices;
+void Board::setVertex(const Vertex& vertex) {
+    writeVertex(editCell(vertex.getCoords()), vertex);
 }
 
-void Board::setShells(const vector<Shell>& shells) {
+void Board::setShells(const ShellPool& shells) {
     shells_ = shells;
 }
 
+void Board::setConsoleOutput(bool console_output) {
+    consoleOutput_ = console_output;
+}
+
+void Board::setThreadPool(ThreadPool* thread_pool, size_t min_parallel_shells) {
+    threadPool_ = thread_pool;
+    minParallelShells_ = min_parallel_shells;
+}
+
 /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
 
 void Board::render() const {
+    string line;
     for (int i = 0; i < rows_; i++) {
+        line.clear();
         for (int j = 0; j < columns_; j++) {
-            cout << grid_[i][j] << " ";
+            line += cellToString(cells_[i * columns_ + j]);
+            line += ' ';
         }
-        cout << endl;
+        cout << line << '\n';
     }
 }
 
+Board Board::clone() const {
+    Board board;
+    board.rows_ = rows_;
+    board.columns_ = columns_;
+    board.cells_ = cells_;
+    board.shells_ = shells_;
+    board.tanks_ = tanks_;
+    board.playerATanks_ = playerATanks_;
+    board.playerBTanks_ = playerBTanks_;
+    board.consoleOutput_ = false;
+    board.trackDirtyCells_ = false;
+    board.hashStale_ = true;
+    return board;
+}
+
+void Board::writeState(ostream& out) const {
+    BinaryIO::writeUint32(out, rows_);
+    BinaryIO::writeUint32(out, columns_);
+    out.write(reinterpret_cast<const char*>(cells_.data()), cells_.size());
+    BinaryIO::writeUint32(out, shells_.size());
+    for (size_t i = 0; i < shells_.size(); ++i) {
+        BinaryIO::writeUint32(out, shells_.getPos(i).first);
+        BinaryIO::writeUint32(out, shells_.getPos(i).second);
+        BinaryIO::writeUint8(out, directionToIndex(shells_.getDir(i)));
+        BinaryIO::writeUint8(out, (shells_.isFresh(i) ? 1 : 0) | (shells_.hasExploded(i) ? 2 : 0));
+    }
+    BinaryIO::writeUint32(out, tanks_.size());
+    for (const Tank& tank : tanks_) {
+        BinaryIO::writeUint32(out, tank.getPos().first);
+        BinaryIO::writeUint32(out, tank.getPos().second);
+        BinaryIO::writeUint8(out, directionToIndex(tank.getDir()));
+        BinaryIO::writeUint8(out, tank.getPlayerInd());
+        BinaryIO::writeInt32(out, tank.getAmmo());
+        BinaryIO::writeInt32(out, tank.getBackCnt());
+        BinaryIO::writeInt32(out, tank.getLastShotCnt());
+        BinaryIO::writeUint8(out, (tank.alive() ? 1 : 0) | (tank.steppedOnAMine() ? 2 : 0) |
+            (tank.hitByAShell() ? 4 : 0) | (tank.crashedWithOtherTank() ? 8 : 0));
+    }
+    BinaryIO::writeInt32(out, playerATanks_);
+    BinaryIO::writeInt32(out, playerBTanks_);
+}
+
+Board Board::readState(istream& in) {
+    Board board;
+    board.rows_ = BinaryIO::readUint32(in);
+    board.columns_ = BinaryIO::readUint32(in);
+    board.cells_.resize(static_cast<size_t>(board.rows_) * board.columns_);
+    in.read(reinterpret_cast<char*>(board.cells_.data()), board.cells_.size());
+    if (static_cast<size_t>(in.gcount()) != board.cells_.size()) {
+        throw runtime_error("Unexpected end of binary file");
+    }
+    size_t shells = BinaryIO::readUint32(in);
+    for (size_t i = 0; i < shells; ++i) {
+        int x = BinaryIO::readUint32(in);
+        int y = BinaryIO::readUint32(in);
+        Direction dir = indexToDirection(BinaryIO::readUint8(in));
+        uint8_t state = BinaryIO::readUint8(in);
+        board.shells_.addShell({x, y}, dir);
+        board.shells_.setFresh(i, state & 1);
+        board.shells_.setExploded(i, state & 2);
+    }
+    size_t tanks = BinaryIO::readUint32(in);
+    for (size_t i = 0; i < tanks; ++i) {
+        int x = BinaryIO::readUint32(in);
+        int y = BinaryIO::readUint32(in);
+        Direction dir = indexToDirection(BinaryIO::readUint8(in));
+        int player_ind = BinaryIO::readUint8(in);
+        int ammo = BinaryIO::readInt32(in);
+        int back_cnt = BinaryIO::readInt32(in);
+        int last_shot_cnt = BinaryIO::readInt32(in);
+        uint8_t state = BinaryIO::readUint8(in);
+        board.tanks_.emplace_back(make_pair(x, y), dir, player_ind, ammo, back_cnt, last_shot_cnt,
+            state & 1, state & 2, state & 4, state & 8);
+    }
+    board.playerATanks_ = BinaryIO::readInt32(in);
+    board.playerBTanks_ = BinaryIO::readInt32(in);
+    board.consoleOutput_ = false;
+    board.trackDirtyCells_ = false;
+    board.hashStale_ = true;
+    return board;
+}
+
 int Board::getNeighborXCoord(int currentX, int deltaX) {
     int newX = currentX + deltaX;
     if (newX < 0) { newX = rows_ - 1; }
@@ -189,129 +324,245 @@ pair<int, int> Board::getNeighborCoords(pair<int, int> current_pos, Direction di
 }
 
 void Board::placeTankA(pair<int, int> pos, int ammo) {
-    grid_[pos.first][pos.second] = "1";
+    editCell(pos) |= CellFlag::TANK_A;
     Tank newTank = Tank(pos, Direction::L, 1, ammo);
+    if (!hashStale_) { tanksHash_ ^= Zobrist::tankKey(tanks_.size(), newTank); }
     tanks_.push_back(newTank);
     playerATanks_++;
 }
 
 void Board::placeTankB(pair<int, int> pos, int ammo) {
-    grid_[pos.first][pos.second] = "2";
+    editCell(pos) |= CellFlag::TANK_B;
     Tank newTank = Tank(pos, Direction::R, 2, ammo);
+    if (!hashStale_) { tanksHash_ ^= Zobrist::tankKey(tanks_.size(), newTank); }
     tanks_.push_back(newTank);
     playerBTanks_++;
 }
 
 void Board::placeWall(pair<int, int> pos) {
-    grid_[pos.first][pos.second] = "#";
-    for (auto pair : vertices_) {
-        if (pair.first == pos) {
-            pair.second.setHP(0);
-            pair.second.setWall(true);
-        }
-    }
+    Cell& cell = editCell(pos);
+    cell |= CellFlag::WALL;
+    setCellWallHP(cell, 0);
 }
 
 void Board::placeMine(pair<int, int> pos) {
-    grid_[pos.first][pos.second] = "@";
-    for (auto pair : vertices_) { if (pair.first == pos) { pair.second.setMine(true); } }
+    editCell(pos) |= CellFlag::MINE;
+}
+
+void Board::addNewShell(int X, int Y, Direction dir) {
+    shells_.addShell({X, Y}, dir);
+    editCell({X, Y}) |= CellFlag::SHELL;
+}
+
+void Board::removeShell(int shellInd) {
+    editCell(shells_.getPos(shellInd)) &= ~CellFlag::SHELL;
+    shells_.swapAndPop(shellInd);
 }
 
-void Board::addNewVertexToMap(int X, int Y, bool is_wall, bool is_mine) {
-    vector<pair<int, int>> adj = vector<pair<int, int>>();
-    adj.reserve(8);
-    for (int i = 0; i < 8; i++) {
-        Direction dir = indexToDirection(i);
-        adj.push_back(getNeighborCoords({X, Y}, dir));
+void Board::moveShell(int shellInd) {
+    editCell(shells_.getPos(shellInd)) &= ~CellFlag::SHELL;
+    editCell(shells_.moveShell(shellInd, rows_, columns_)) |= CellFlag::SHELL;
+}
+
+void Board::markDirty(int index) {
+    if (!trackDirtyCells_) { return; }
+    if (cellMarks_.size() != cells_.size()) { cellMarks_.assign(cells_.size(), 0); }
+    if (!(cellMarks_[index] & DIRTY_MARK)) {
+        cellMarks_[index] |= DIRTY_MARK;
+        dirtyCells_.push_back(index);
     }
-    Vertex vertex(adj, X, Y, 0, is_wall, is_mine);
-    if (is_wall) {
-        vertex.setHP(0);
-        grid_[X][Y] = "#";
+}
+
+Cell& Board::editCell(int index, TileEdits* edits) {
+    if (!edits) {
+        markDirty(index);
+        markHashPending(index);
+        return cells_[index];
     }
-    else if (is_mine) { grid_[X][Y] = "@"; }
-    vertices_[{X, Y}] = vertex;
+    /* The marks were sized by prepareTiles(), as resizing them here would race with the other tiles. */
+    if (trackDirtyCells_ && !(cellMarks_[index] & DIRTY_MARK)) {
+        cellMarks_[index] |= DIRTY_MARK;
+        edits->dirtyCells.push_back(index);
+    }
+    markHashPending(index, edits);
+    return cells_[index];
 }
 
-void Board::addExistingVertexToMap(Vertex vertex) {
-    if (vertex.isWall()) { grid_[vertex.getX()][vertex.getY()] = "#"; }
-    if (vertex.isMine()) { grid_[vertex.getX()][vertex.getY()] = "@"; }
-    vertices_[{vertex.getX(), vertex.getY()}] = vertex;
+void Board::markAllDirty() {
+    for (size_t index = 0; index < cells_.size(); ++index) { markDirty(index); }
 }
 
-void Board::initializeBoard() {
-    /* In this implementation, the grid would be fully initialized by the game manager! */
-    // Initializing vertices
-    for (int i = 0; i < rows_; i++) {
-        for (int j = 0; j < columns_; j++) {
-            if (grid_[i][j] == "#") { addNewVertexToMap(i, j, true, false); }
-            else if (grid_[i][j] == "@") { addNewVertexToMap(i, j, false, true); }
-            else { addNewVertexToMap(i, j); }
-        }
-    }
+Cell& Board::editCell(pair<int, int> pos) {
+    return editCell(cellIndex(pos), nullptr);
 }
 
-void Board::addNewShell(int X, int Y, Direction dir) {
-    vector<pair<int, int>> affected_positions;
-    affected_positions.reserve(8);
-    affected_positions.push_back({X, Y});
-    pair<int, int> pos = {X, Y};
-    for (int i = 0; i < 7; i++) {
-        pos = getNeighborCoords(pos, dir);
-        affected_positions.push_back(pos);
+void Board::markHashPending(int index, TileEdits* edits) {
+    if (hashStale_) { return; }
+    if (cellMarks_.size() != cells_.size()) { cellMarks_.assign(cells_.size(), 0); }
+    if (!(cellMarks_[index] & HASH_PENDING_MARK)) {
+        cellMarks_[index] |= HASH_PENDING_MARK;
+        (edits ? edits->hashPendingCells : hashPendingCells_).push_back(index);
+        (edits ? edits->cellsHash : cellsHash_) ^= Zobrist::cellKey(index, cells_[index]);
     }
-    Shell shell(affected_positions, {X, Y}, dir, false);
-    shells_.push_back(shell);
-    if (grid_[X][Y] == "@") { grid_[X][Y] = "*@"; }
-    else { grid_[X][Y] = "*"; }
 }
 
-void Board::removeShell(const Shell& shell) {
-    shells_.erase(remove(shells_.begin(), shells_.end(), shell), shells_.end());
-    grid_[shell.getPos().first][shell.getPos().second] = ".";
+void Board::countTankLost(int player_ind, TileEdits* edits) {
+    if (player_ind == 1) {
+        if (edits) { edits->playerATanksLost++; }
+        else { playerATanks_--; }
+    } else {
+        if (edits) { edits->playerBTanksLost++; }
+        else { playerBTanks_--; }
+    }
 }
 
-void Board::moveShell(Shell& shell) {
-    if (shell.getAffectedPositions().empty()) { throw out_of_range("Shell has no more moves!"); }
-    pair<int, int> next_pos = shell.getAffectedPositions().front();
-    shell.getAffectedPositions().erase(shell.getAffectedPositions().begin());
-    if (grid_[shell.getPos().first][shell.getPos().second] == "*@") {
-        grid_[shell.getPos().first][shell.getPos().second] = "@";
+int Board::prepareTiles() {
+    if (!threadPool_ || threadPool_->getThreads() < 2 || shells_.size() < minParallelShells_) {
+        return 0;
     }
-    else { grid_[shell.getPos().first][shell.getPos().second] = "."; }
-    shell.setPos(next_pos);
-    if (grid_[shell.getPos().first][shell.getPos().second] == "@") {
-        grid_[shell.getPos().first][shell.getPos().second] = "*@";
+    /* A few tiles per thread, so that a tile crowded with shells does not hold all the others back. */
+    int tiles = min(rows_, 4 * threadPool_->getThreads());
+    tileRows_ = (rows_ + tiles - 1) / tiles;
+    tiles = (rows_ + tileRows_ - 1) / tileRows_;
+    if (static_cast<int>(tileEdits_.size()) != tiles) {
+        tileEdits_.assign(tiles, TileEdits());
+        tileKeyCounts_.assign(tiles, CellTable());
     }
-    else { grid_[shell.getPos().first][shell.getPos().second] = "*"; }
-    shell.addAffectedPosition(getNeighborCoords(shell.getAffectedPositions().back(), shell.getDir()));
+    tileOps_.resize(static_cast<size_t>(tiles) * tiles);
+    if (cellMarks_.size() != cells_.size()) { cellMarks_.assign(cells_.size(), 0); }
+    return tiles;
+}
+
+void Board::mergeTileEdits() {
+    /* The dirty-cell and pending-hash lists end up in tile order rather than in the order the cells were
+     * edited, which their users do not depend on, and the hash is XORed together in any order. */
+    for (TileEdits& edits : tileEdits_) {
+        dirtyCells_.insert(dirtyCells_.end(), edits.dirtyCells.begin(), edits.dirtyCells.end());
+        hashPendingCells_.insert(hashPendingCells_.end(), edits.hashPendingCells.begin(),
+            edits.hashPendingCells.end());
+        cellsHash_ ^= edits.cellsHash;
+        playerATanks_ -= edits.playerATanksLost;
+        playerBTanks_ -= edits.playerBTanksLost;
+        edits.dirtyCells.clear();
+        edits.hashPendingCells.clear();
+        edits.cellsHash = 0;
+        edits.playerATanksLost = 0;
+        edits.playerBTanksLost = 0;
+    }
+}
+
+void Board::rehash() {
+    cellsHash_ = 0;
+    for (size_t index = 0; index < cells_.size(); ++index) {
+        cellsHash_ ^= Zobrist::cellKey(index, cells_[index]);
+    }
+    tanksHash_ = 0;
+    for (size_t i = 0; i < tanks_.size(); ++i) { tanksHash_ ^= Zobrist::tankKey(i, tanks_[i]); }
+    hashPendingCells_.clear();
+    if (cellMarks_.size() != cells_.size()) { cellMarks_.assign(cells_.size(), 0); }
+    for (unsigned char& marks : cellMarks_) { marks &= ~HASH_PENDING_MARK; }
+    hashStale_ = false;
+}
+
+void Board::ensureScratchBuffers() {
+    shellKeys_.resize(shells_.size());
+    nextTankAt_.resize(tanks_.size());
 }
 
 void Board::moveAllShells() {
-    // before moving the shells, check for their intersection
+    /* Before moving the shells, check for their intersection. Two shells intersect (see intersect())
+     * if they share a destination or a mid-cell, so instead of comparing every pair, each shell is
+     * hashed by both into counters (destinations at even keys, mid-cells at odd ones), and any shell
+     * sharing a bucket with another explodes. */
+    int tiles = prepareTiles();
+    if (tiles > 0) {
+        moveAllShellsInTiles(tiles);
+        return;
+    }
+    ensureScratchBuffers();
     int n = shells_.size();
+    shellKeyCounts_.clear(2 * n, 0);
     for (int i = 0; i < n; ++i) {
-        for (int j = i + 1; j < n; ++j) {
-            pair<int, int> shell1Pos = shells_[i].getPos();
-            Direction shell1Dir = shells_[i].getDir();
-            pair<int, int> shell1NextPos = getNextCoordsInDir(shell1Dir, shell1Pos, getRows(), getColumns());
-
-            pair<int, int> shell2Pos = shells_[j].getPos();
-            Direction shell2Dir = shells_[j].getDir();
-            pair<int, int> shell2NextPos = getNextCoordsInDir(shell2Dir, shell2Pos, getRows(), getColumns());
-
-            if (intersect(shell1Pos, shell1NextPos, shell2Pos, shell2NextPos)){
-                shells_[i].setExploded(true);
-                shells_[j].setExploded(true);
-            }
-    
+        pair<int, int> shellPos = shells_.getPos(i);
+        pair<int, int> shellNextPos = getNextCoordsInDir(shells_.getDir(i), shellPos, getRows(), getColumns());
+        pair<int, int> shellMidPos = {(shellPos.first + shellNextPos.first) / 2,
+            (shellPos.second + shellNextPos.second) / 2};
+        shellKeys_[i] = {2 * cellIndex(shellNextPos), 2 * cellIndex(shellMidPos) + 1};
+        shellKeyCounts_.edit(shellKeys_[i].first)++;
+        shellKeyCounts_.edit(shellKeys_[i].second)++;
+    }
+    for (int i = 0; i < n; ++i) {
+        if (shellKeyCounts_.get(shellKeys_[i].first) > 1 ||
+            shellKeyCounts_.get(shellKeys_[i].second) > 1) {
+            shells_.setExploded(i, true);
         }
     }
-    for (Shell& shell : shells_) { moveShell(shell); }
+    for (int i = 0; i < n; ++i) { moveShell(i); }
+}
+
+void Board::moveAllShellsInTiles(int tiles) {
+    ensureScratchBuffers();
+    size_t n = shells_.size();
+    size_t chunkSize = (n + tiles - 1) / tiles;
+    auto chunkOps = [this, tiles](size_t chunk, int tile) -> vector<pair<int, int>>& {
+        return tileOps_[chunk * tiles + tile];
+    };
+
+    /* The shells are split into as many chunks as there are tiles, and each chunk routes its shells'
+     * collision keys (see moveAllShells()) to the tiles owning their cells, as (shell, key) pairs. */
+    threadPool_->parallelFor(tiles, [&](size_t chunk) {
+        for (int tile = 0; tile < tiles; ++tile) { chunkOps(chunk, tile).clear(); }
+        for (size_t i = chunk * chunkSize; i < min(n, (chunk + 1) * chunkSize); ++i) {
+            pair<int, int> shellPos = shells_.getPos(i);
+            pair<int, int> shellNextPos = getNextCoordsInDir(shells_.getDir(i), shellPos, rows_,
+                columns_);
+            pair<int, int> shellMidPos = {(shellPos.first + shellNextPos.first) / 2,
+                (shellPos.second + shellNextPos.second) / 2};
+            shellKeys_[i] = {2 * cellIndex(shellNextPos), 2 * cellIndex(shellMidPos) + 1};
+            chunkOps(chunk, tileOf(shellKeys_[i].first / 2)).push_back({i, shellKeys_[i].first});
+            chunkOps(chunk, tileOf(shellKeys_[i].second / 2)).push_back({i, shellKeys_[i].second});
+        }
+    });
+    /* Every tile counts the keys of its own cells... */
+    threadPool_->parallelFor(tiles, [&](size_t tile) {
+        size_t keys = 0;
+        for (int chunk = 0; chunk < tiles; ++chunk) { keys += chunkOps(chunk, tile).size(); }
+        tileKeyCounts_[tile].clear(keys, 0);
+        for (int chunk = 0; chunk < tiles; ++chunk) {
+            for (const auto& [shell, key] : chunkOps(chunk, tile)) { tileKeyCounts_[tile].edit(key)++; }
+        }
+    });
+    /* ...and then each chunk explodes its shells sharing a key with another, and moves them. Moving a
+     * shell edits the cell it leaves and then the one it enters, so these edits are routed to the tiles
+     * owning them as (cell, enters) pairs, keeping every tile's edits in the order of the serial loop. */
+    threadPool_->parallelFor(tiles, [&](size_t chunk) {
+        for (int tile = 0; tile < tiles; ++tile) { chunkOps(chunk, tile).clear(); }
+        for (size_t i = chunk * chunkSize; i < min(n, (chunk + 1) * chunkSize); ++i) {
+            auto [destination, mid] = shellKeys_[i];
+            if (tileKeyCounts_[tileOf(destination / 2)].get(destination) > 1 ||
+                tileKeyCounts_[tileOf(mid / 2)].get(mid) > 1) {
+                    shells_.setExploded(i, true);
+                }
+            int from = cellIndex(shells_.getPos(i));
+            int to = cellIndex(shells_.moveShell(i, rows_, columns_));
+            chunkOps(chunk, tileOf(from)).push_back({from, 0});
+            chunkOps(chunk, tileOf(to)).push_back({to, 1});
+        }
+    });
+    threadPool_->parallelFor(tiles, [&](size_t tile) {
+        for (int chunk = 0; chunk < tiles; ++chunk) {
+            for (const auto& [index, enters] : chunkOps(chunk, tile)) {
+                Cell& cell = editCell(index, &tileEdits_[tile]);
+                if (enters) { cell |= CellFlag::SHELL; }
+                else { cell &= ~CellFlag::SHELL; }
+            }
+        }
+    });
+    mergeTileEdits();
 }
 
 bool Board::placeTaken(pair<int, int> pos) {
-    return (grid_[pos.first][pos.second] != "." && grid_[pos.first][pos.second] != "1" && grid_[pos.first][pos.second] != "2");
+    return (cells_[cellIndex(pos)] & (CellFlag::WALL | CellFlag::MINE | CellFlag::SHELL)) != 0;
 }
 
 bool Board::intersect(pair<int, int> objectA_start, pair<int, int> objectA_des,
@@ -328,7 +579,7 @@ bool Board::intersect(pair<int, int> objectA_start, pair<int, int> objectA_des,
     }
 
 void Board::removeTankFromGrid(pair<int, int> pos) {
-    grid_[pos.first][pos.second] = ".";
+    editCell(pos) &= ~CellFlag::TANK;
 }
 
 bool Board::move(ActionRequest action, int tankInd) {
@@ -342,7 +593,7 @@ bool Board::move(ActionRequest action, int tankInd) {
             tanks_[tankInd].resetBackCnt();
             return true;
         }
-        next_pos = this->getVertices().at(current_pos).getAdjCoordInDirection(dir);
+        next_pos = getNeighborCoords(current_pos, dir);
         if (placeTaken(next_pos)){
             return false;
         }
@@ -352,7 +603,7 @@ bool Board::move(ActionRequest action, int tankInd) {
             tanks_[tankInd].setBackCnt(2);
         } else if (tanks_[tankInd].getBackCnt() == 0) {
             Direction opposite = rotateRightQuarter(rotateRightQuarter(dir));
-            next_pos = this->getVertices().at(current_pos).getAdjCoordInDirection(opposite);
+            next_pos = getNeighborCoords(current_pos, opposite);
             if (placeTaken(next_pos)){
                 return false;
             }
@@ -396,6 +647,15 @@ bool Board::rotate(ActionRequest action, int tankInd) {
 }
 
 bool Board::act(ActionRequest action, int tankInd) {
+    if (hashStale_) { return applyAction(action, tankInd); }
+    /* Only the acting tank can change, so only its key is replaced in the hash. */
+    tanksHash_ ^= Zobrist::tankKey(tankInd, tanks_[tankInd]);
+    bool success = applyAction(action, tankInd);
+    tanksHash_ ^= Zobrist::tankKey(tankInd, tanks_[tankInd]);
+    return success;
+}
+
+bool Board::applyAction(ActionRequest action, int tankInd) {
     tanks_[tankInd].decreaseLastShotCount();
 
     if (tanks_[tankInd].shouldWait(action)) {
@@ -421,81 +681,53 @@ std::pair<int, int> Board::getPosTank(int i) const{
     return tanks_[i].getPos();
 }
 
-vector<pair<size_t, size_t>> Board::updateObjectsOnBoard() {
-    vector<Shell> newShells;
-
-    // Update all shells
-    for (auto& shell : getShells()) {
-        Shell shellPos = shell;
-        auto [x, y] = shellPos.getPos();
-
-        // Check collision with any tank
-        for (auto& tank : tanks_) {
-            if (!tank.alive()){
-                continue;
-            }
-            if (tank.getPos() == shellPos.getPos()) {
-                tank.kaboom();
-                if (tank.getPlayerInd() == 1){
-                    playerATanks_--;
-                }
-                else{
-                    playerBTanks_--;
-                }
-                removeTankFromGrid(tank.getPos());
-                shell.setExploded(true);
-                break;
-            }
-        }
+int Board::getNumTanks() const {
+    return tanks_.size();
+}
 
-        // Now check for collision with walls
-        Vertex shell_vertex;
-        for (auto& pair : getVertices()) {
-            if (pair.first == shellPos.getPos()) {
-                shell_vertex = pair.second;
-                break;
-            }
-        }
+const vector<int>& Board::getDirtyCells() const {
+    return dirtyCells_;
+}
 
-        if (shell_vertex.isWall()) {
-            shell_vertex.increaseHP();
-            shell.setExploded(true);
-            if (shell_vertex.shouldWreckWall()) {
-                shell_vertex.wreckWall();
-                grid_[x][y] = ".";
-            }
+void Board::updateObjectsOnBoard() {
+    /* Hashing the living tanks by cell, so each collision check only looks at the tanks on its own cell.
+     * Every cell's tanks are chained in ascending index order, which is the order they used to be
+     * checked in. */
+    ensureScratchBuffers();
+    tankAt_.clear(tanks_.size(), -1);
+    for (int i = static_cast<int>(tanks_.size()) - 1; i >= 0; --i) {
+        if (!tanks_[i].alive()){
+            continue;
         }
+        /* XORed back in below, if it is still alive. */
+        if (!hashStale_) { tanksHash_ ^= Zobrist::tankKey(i, tanks_[i]); }
+        int& head = tankAt_.edit(cellIndex(tanks_[i].getPos()));
+        nextTankAt_[i] = head;
+        head = i;
+    }
 
-        // Only add shells that didn't explode
-        if (!shell.hasExploded()) {
-            newShells.push_back(shell);
-        } else {
-            if (grid_[x][y] == "*@") {
-                grid_[x][y] = "@";
-            } else {
-                grid_[x][y] = ".";
-            }
-        }
+    // Update all shells
+    int tiles = prepareTiles();
+    if (tiles > 0) {
+        resolveShellsInTiles(tiles);
+    } else {
+        for (size_t i = 0; i < shells_.size(); ++i) { resolveShell(i, nullptr); }
     }
 
     // Kill tanks if they step on mines
-    for (auto& pair : getVertices()) {
-        for (auto& tank : tanks_) {
-            if (!tank.alive()){
-                continue;
+    for (auto& tank : tanks_) {
+        if (!tank.alive()){
+            continue;
+        }
+        if (getCell(tank.getPos()) & CellFlag::MINE) {
+            tank.stepOnAMine();
+            if (tank.getPlayerInd() == 1){
+                playerATanks_--;
             }
-            if (pair.first == tank.getPos()) {
-                if (pair.second.isMine()) {
-                    tank.stepOnAMine();
-                    if (tank.getPlayerInd() == 1){
-                        playerATanks_--;
-                    }
-                    else{
-                        playerBTanks_--;
-                    }
-                    removeTankFromGrid(tank.getPos());
-                }
+            else{
+                playerBTanks_--;
             }
+            removeTankFromGrid(tank.getPos());
         }
     }
 
@@ -504,28 +736,26 @@ vector<pair<size_t, size_t>> Board::updateObjectsOnBoard() {
         if (!tanks_[i].alive()){
             continue;
         }
-        for (size_t j = i + 1; j < tanks_.size(); ++j) {
-            if (!tanks_[j].alive()){
+        for (int j = tankAt_.get(cellIndex(tanks_[i].getPos())); j != -1; j = nextTankAt_[j]) {
+            if (j <= static_cast<int>(i) || !tanks_[j].alive()){
                 continue;
             }
-            if (tanks_[i].getPos() == tanks_[j].getPos()) {
-                tanks_[i].batteringRam();
-                tanks_[j].batteringRam();
-                if (tanks_[i].getPlayerInd() == 1){
-                    playerATanks_--;
-                }
-                else{
-                    playerBTanks_--;
-                }
-                if (tanks_[j].getPlayerInd() == 1){
-                    playerATanks_--;
-                }
-                else{
-                    playerBTanks_--;
-                }
-                removeTankFromGrid(tanks_[i].getPos());
-                removeTankFromGrid(tanks_[j].getPos());
+            tanks_[i].batteringRam();
+            tanks_[j].batteringRam();
+            if (tanks_[i].getPlayerInd() == 1){
+                playerATanks_--;
+            }
+            else{
+                playerBTanks_--;
+            }
+            if (tanks_[j].getPlayerInd() == 1){
+                playerATanks_--;
             }
+            else{
+                playerBTanks_--;
+            }
+            removeTankFromGrid(tanks_[i].getPos());
+            removeTankFromGrid(tanks_[j].getPos());
         }
     }
 
@@ -534,33 +764,100 @@ vector<pair<size_t, size_t>> Board::updateObjectsOnBoard() {
         if (!tanks_[i].alive()){
             continue;
         }
-        auto [x, y] = tanks_[i].getPos();
-        grid_[x][y] = std::to_string(tanks_[i].getPlayerInd());
+        if (!hashStale_) { tanksHash_ ^= Zobrist::tankKey(i, tanks_[i]); }
+        editCell(tanks_[i].getPos()) |= tankFlagOf(tanks_[i].getPlayerInd());
     }
 
     // Update shells on the board
-    setShells(newShells);
+    shells_.removeExploded();
 
-    vector<pair<size_t, size_t>> newTankPositions;
-    // Update the positions of tanks in the UI (or other purposes)
-    for (size_t i = 0; i < tanks_.size(); ++i) {
-        auto pos = getPosTank(i);
-        Tank tank = tanks_[i];
+    // Report the positions of the tanks still alive
+    for (size_t i = 0; consoleOutput_ && i < tanks_.size(); ++i) {
+        if (!tanks_[i].alive()){
+            continue;
+        }
+        cout << "Tank " << i + 1 << " is now at position (" <<
+            getPosTank(i).first << ", " <<
+            getPosTank(i).second << ")." << '\n';
+    }
+}
+
+void Board::resolveShell(size_t i, TileEdits* edits) {
+    pair<int, int> pos = shells_.getPos(i);
+    int index = cellIndex(pos);
+
+    // Check collision with any tank
+    for (int t = tankAt_.get(index); t != -1; t = nextTankAt_[t]) {
+        Tank& tank = tanks_[t];
         if (!tank.alive()){
             continue;
         }
-        if (tank.getPlayerInd() == 1){
-            grid_[pos.first][pos.second] = "1";
+        tank.kaboom();
+        countTankLost(tank.getPlayerInd(), edits);
+        editCell(index, edits) &= ~CellFlag::TANK;
+        shells_.setExploded(i, true);
+        break;
+    }
+
+    // Now check for collision with walls
+    Cell& cell = editCell(index, edits);
+    if (cell & CellFlag::WALL) {
+        Vertex shell_vertex = getVertex(pos);
+        shell_vertex.increaseHP();
+        shells_.setExploded(i, true);
+        if (shell_vertex.shouldWreckWall()) { shell_vertex.wreckWall(); }
+        writeVertex(cell, shell_vertex);
+    }
+
+    // Only keep shells that didn't explode
+    if (shells_.hasExploded(i)) {
+        cell &= ~CellFlag::SHELL;
+    }
+}
+
+void Board::resolveShellsInTiles(int tiles) {
+    size_t n = shells_.size();
+    size_t chunkSize = (n + tiles - 1) / tiles;
+    auto chunkOps = [this, tiles](size_t chunk, int tile) -> vector<pair<int, int>>& {
+        return tileOps_[chunk * tiles + tile];
+    };
+
+    /* A shell only affects its own cell and the tanks on it, so every tile resolves the shells on its
+     * cells, in the order they were fired, just as the serial loop does. */
+    threadPool_->parallelFor(tiles, [&](size_t chunk) {
+        for (int tile = 0; tile < tiles; ++tile) { chunkOps(chunk, tile).clear(); }
+        for (size_t i = chunk * chunkSize; i < min(n, (chunk + 1) * chunkSize); ++i) {
+            int index = cellIndex(shells_.getPos(i));
+            chunkOps(chunk, tileOf(index)).push_back({i, index});
         }
-        else{
-            grid_[pos.first][pos.second] = "2";
+    });
+    threadPool_->parallelFor(tiles, [&](size_t tile) {
+        for (int chunk = 0; chunk < tiles; ++chunk) {
+            for (const auto& [shell, index] : chunkOps(chunk, tile)) {
+                resolveShell(shell, &tileEdits_[tile]);
+            }
         }
-        newTankPositions.emplace_back(static_cast<size_t>(pos.first), static_cast<size_t>(pos.second));
-        cout << "Tank " << i + 1 << " is now at position (" <<
-            getPosTank(i).first << ", " <<
-            getPosTank(i).second << ")." << endl;
+    });
+    mergeTileEdits();
+}
+
+void Board::clearDirtyCells() {
+    for (int index : dirtyCells_) { cellMarks_[index] &= ~DIRTY_MARK; }
+    dirtyCells_.clear();
+}
+
+uint64_t Board::hashState() {
+    if (hashStale_) { rehash(); }
+    for (int index : hashPendingCells_) {
+        cellsHash_ ^= Zobrist::cellKey(index, cells_[index]);
+        cellMarks_[index] &= ~HASH_PENDING_MARK;
     }
-    return newTankPositions;
+    hashPendingCells_.clear();
+    uint64_t hash = cellsHash_ ^ tanksHash_;
+    for (size_t i = 0; i < shells_.size(); ++i) {
+        hash ^= Zobrist::shellKey(cellIndex(shells_.getPos(i)), shells_.getDir(i), shells_.isFresh(i));
+    }
+    return hash;
 }
 
 
@@ -568,12 +865,22 @@ vector<pair<size_t, size_t>> Board::updateObjectsOnBoard() {
 void Board::resetBoard() {
     rows_ = 0;
     columns_ = 0;
-    grid_.clear();
-    vector<vector<string>>().swap(grid_);
-    vertices_.clear();
-    map<pair<int, int>, Vertex>().swap(vertices_);
-    shells_.clear();
-    vector<Shell>().swap(shells_);
+    cells_.clear();
+    vector<Cell>().swap(cells_);
+    shells_.resetShellPool();
+    tanks_.clear();
+    playerATanks_ = 0;
+    playerBTanks_ = 0;
+    shellKeys_.clear();
+    shellKeyCounts_ = CellTable();
+    tankAt_ = CellTable();
+    nextTankAt_.clear();
+    dirtyCells_.clear();
+    cellMarks_.clear();
+    cellsHash_ = 0;
+    tanksHash_ = 0;
+    hashPendingCells_.clear();
+    hashStale_ = false;
 }
 
 bool Board::isTankAlive(int tankInd){
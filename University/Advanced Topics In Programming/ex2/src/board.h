@@ -5,25 +5,114 @@
  */
 
 #pragma once
+#include <cstdint>
 #include <iostream>
-#include <map>
 #include "vertex.h"
-#include "shell.h"
+#include "cell.h"
+#include "cell_table.h"
+#include "shell_pool.h"
+#include "thread_pool.h"
 #include "ActionRequest.h"
 #include "tank.h"
 
 class Board {
     private:
+        /* The edits made to one tile's cells while the shells are updated in parallel (see
+         * setThreadPool()), merged into the board's own lists and counters once all tiles are done. */
+        struct TileEdits {
+            std::vector<int> dirtyCells;
+            std::vector<int> hashPendingCells;
+            std::uint64_t cellsHash = 0;
+            int playerATanksLost = 0;
+            int playerBTanksLost = 0;
+        };
+
         int rows_;
         int columns_;
-        std::vector<std::vector<std::string>> grid_;
-        std::map<std::pair<int, int>, Vertex> vertices_;
-        std::vector<Shell> shells_;
+        std::vector<Cell> cells_;
+        ShellPool shells_;
         std::vector<Tank> tanks_;
         int playerATanks_;
         int playerBTanks_;
+        /* Scratch buffers for the collision checks, kept between rounds to avoid reallocating them. They
+         * are refilled by every moveAllShells() and updateObjectsOnBoard(), so they are not part of the
+         * board's state. The tables only hold the cells the shells and the living tanks are on, so their
+         * size follows the number of objects rather than the size of the board. */
+        std::vector<std::pair<int, int>> shellKeys_;
+        CellTable shellKeyCounts_;
+        CellTable tankAt_;
+        std::vector<int> nextTankAt_;
+        /* Set only for boards whose shells are updated in parallel, and kept by the board object rather
+         * than copied with its state. The board is then split into tiles of tileRows_ whole rows each,
+         * and every edit of a cell is made by the tile owning it, so no cell is written by 2 threads. */
+        ThreadPool* threadPool_ = nullptr;
+        std::size_t minParallelShells_ = DEFAULT_MIN_PARALLEL_SHELLS;
+        int tileRows_ = 1;
+        std::vector<TileEdits> tileEdits_;
+        /* The work routed to each tile, listed per chunk of shells: tileOps_[chunk * tiles + tile]. */
+        std::vector<std::vector<std::pair<int, int>>> tileOps_;
+        std::vector<CellTable> tileKeyCounts_;
+        /* The indices of the cells written to since the last clearDirtyCells(), each listed once. */
+        std::vector<int> dirtyCells_;
+        /* Whether each cell is on the dirty-cell list, and on the list of cells pending in the state hash
+         * (see below). Both are kept in the same array, as every cell edit checks both. */
+        static constexpr unsigned char DIRTY_MARK = 1 << 0;
+        static constexpr unsigned char HASH_PENDING_MARK = 1 << 1;
+        std::vector<unsigned char> cellMarks_;
+        bool consoleOutput_ = true;
+        /* Off only for clones (see clone()), which no satellite view is ever synced from. */
+        bool trackDirtyCells_ = true;
+        /* The state hash (see hashState()) is kept in parts: the cells' and the tanks' keys are kept up to
+         * date as they change, except for the cells edited since the last hashState(), whose old keys are
+         * already XORed out and whose new ones are only XORed in by it. If the hash is stale (as it is in
+         * clones, which are rarely hashed), none of it is kept up to date, and it is computed from scratch
+         * by the next hashState(). */
+        std::uint64_t cellsHash_ = 0;
+        std::uint64_t tanksHash_ = 0;
+        std::vector<int> hashPendingCells_;
+        bool hashStale_ = false;
+
+        /** Sizes the collision scratch buffers for the board's current shells and tanks. */
+        void ensureScratchBuffers();
+        /** Adds the cell at the given index to the dirty-cell list, unless it is already there. */
+        void markDirty(int index);
+        /** Adds every cell of the board to the dirty-cell list. */
+        void markAllDirty();
+        /** Gets a writable reference to the cell at the given (X, Y) coordinates, marking it dirty. */
+        Cell& editCell(std::pair<int, int> pos);
+        /** Gets a writable reference to the cell at the given index, marking it dirty in the given tile's
+         * edits, or in the board's own lists if there are none. */
+        Cell& editCell(int index, TileEdits* edits);
+        /** XORs the current key of the cell at the given index out of the hash, unless it is already
+         * pending since the last hashState(). */
+        void markHashPending(int index, TileEdits* edits = nullptr);
+        /** Counts a tank of the given player as killed, in the given tile's edits if there are any. */
+        void countTankLost(int player_ind, TileEdits* edits);
+        /** Resolves the i-th shell's collisions with the tanks and the wall on its cell, as described in
+         * updateObjectsOnBoard(). */
+        void resolveShell(size_t i, TileEdits* edits);
+        /** Gets the number of tiles the board is split into for parallel updates, or 0 if the shells
+         * should be updated serially. */
+        int prepareTiles();
+        /** Gets the tile owning the cell at the given index. */
+        int tileOf(int index) const { return index / columns_ / tileRows_; }
+        /** Merges the tiles' edits into the board's own lists and counters. */
+        void mergeTileEdits();
+        /** Moves all the shells as moveAllShells() does, tile by tile in parallel. */
+        void moveAllShellsInTiles(int tiles);
+        /** Resolves all the shells' collisions as resolveShell() does, tile by tile in parallel. */
+        void resolveShellsInTiles(int tiles);
+        /** Computes the cells' and the tanks' parts of the state hash from scratch. */
+        void rehash();
+        /** Applies the given tank's action, as described in act(). */
+        bool applyAction(ActionRequest action, int tankInd);
 
     public:
+        /** The number of shells in flight below which the board updates them serially even if it has a
+         * thread pool (see setThreadPool()): below it, handing the shells out to the tiles costs more
+         * than the threads can save (see the README for how it was chosen). */
+        static constexpr std::size_t DEFAULT_MIN_PARALLEL_SHELLS = 2048;
+
         /* -------------------------------------- CONSTRUCTORS: -------------------------------------- */
 
         /** Default constructor. */
@@ -31,20 +120,20 @@ class Board {
         /** Constructor with values ONLY for rows_ and columns_. */
         Board(int rows, int columns);
         /** Constructor with values for all fields. */
-        Board(int rows, int columns, const std::vector<std::vector<std::string>>& grid,
-            const std::map<std::pair<int, int>, Vertex>& vertices, const std::vector<Shell>& shells);
-        /** Default Copy Constructor. */
+        Board(int rows, int columns, const std::vector<Cell>& cells, const ShellPool& shells);
+        /** Copy Constructor, copying the whole state of the board, including its tanks and its dirty-cell
+         * list. */
         Board(const Board& board);
-        /** Default Move Constructor. */
+        /** Move Constructor, taking over the given board's buffers in O(1) and leaving it reset. */
         Board(Board&& board) noexcept;
         /** Default Deconstructor. */
         ~Board() = default;
 
         /* ---------------------------------------- OPERATORS: --------------------------------------- */
 
-        /** Default Assignment Operator. */
+        /** Assignment Operator, copying the whole state of the board, as the copy constructor does. */
         Board& operator=(const Board& board);
-        /** Default Move Assignment Operator. */
+        /** Move Assignment Operator, taking over the given board's buffers in O(1) and leaving it reset. */
         Board& operator=(Board&& board) noexcept;
         /** Default Equality Operator. */
         bool operator==(const Board& board) const;
@@ -57,18 +146,25 @@ class Board {
         int getRows() const;
         /** Gets the number of columns in the board. */
         int getColumns() const;
-        /** Gets the grid matrix that describes the board's state, without the ability to modify it. */
-        const std::vector<std::vector<std::string>>& getGrid() const;
-        /** Gets the grid matrix that describes the board's state, with the ability to modify it. */
-        std::vector<std::vector<std::string>>& getGrid();
-        /** Gets the map of all the vertices the board consists of. */
-        const std::map<std::pair<int, int>, Vertex>& getVertices() const;
-        /** Gets the vector denoting all shells on the board. */
-        const std::vector<Shell>& getShells() const;
-        /** Gets a non-const version of the vector denoting all shells on the board. */
-        std::vector<Shell>& getShells();
+        /** Gets the row-major cell array that describes the board's state. */
+        const std::vector<Cell>& getCells() const;
+        /** Gets the cell at the given (X, Y) coordinates. */
+        Cell getCell(std::pair<int, int> pos) const;
+        /** Gets the index of the given (X, Y) coordinates in the row-major cell array. */
+        int cellIndex(std::pair<int, int> pos) const;
+        /** Gets the vertex at the given (X, Y) coordinates, as described by its cell. */
+        Vertex getVertex(std::pair<int, int> pos) const;
+        /** Gets the pool of all shells on the board. */
+        const ShellPool& getShells() const;
+        /** Gets a non-const version of the pool of all shells on the board. */
+        ShellPool& getShells();
 
         std::pair<int, int> getPosTank(int i) const;
+        /** Gets the number of tanks placed on the board, dead ones included. */
+        int getNumTanks() const;
+        /** Gets the indices (in the row-major cell array) of all the cells that may have changed since
+         * the last call to clearDirtyCells(). */
+        const std::vector<int>& getDirtyCells() const;
         int getPlayerATanks() const;
         int getPlayerBTanks() const;
         /* ----------------------------------------- SETTERS: ---------------------------------------- */
@@ -77,17 +173,38 @@ class Board {
         void setRows(int rows);
         /** Sets the number of columns in the board to the given integer. */
         void setColumns(int columns);
-        /** Sets the grid matrix that describes the board's state to the given one. */
-        void setGrid(const std::vector<std::vector<std::string>>& grid);
-        /** Sets the map of all the vertices the board consists of to the given one. */
-        void setVertices(const std::map<std::pair<int, int>, Vertex>& vertices);
-        /** Sets the vector denoting all shells on the board to the given one. */
-        void setShells(const std::vector<Shell>& shells);
+        /** Sets the row-major cell array that describes the board's state to the given one. */
+        void setCells(const std::vector<Cell>& cells);
+        /** Writes the given vertex's wall, mine and HP attributes into the cell at its coordinates. */
+        void setVertex(const Vertex& vertex);
+        /** Sets the pool of all shells on the board to the given one. */
+        void setShells(const ShellPool& shells);
+        /** Sets whether updateObjectsOnBoard() reports the tanks' positions on the console. */
+        void setConsoleOutput(bool console_output);
+        /** Sets the thread pool on which moveAllShells() and updateObjectsOnBoard() update the shells of
+         * large boards (or nullptr to always update them serially). The board is split into bands of
+         * rows, and the shells' effects on every cell are replayed by its band in the order the shells
+         * were fired, so the result is exactly the serial one. The shells are only split between the
+         * threads while at least the given number of them are in flight. The pool must outlive its use
+         * by the board, and is not passed on to copies of it. */
+        void setThreadPool(ThreadPool* thread_pool,
+            std::size_t min_parallel_shells = DEFAULT_MIN_PARALLEL_SHELLS);
 
         /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
 
         /** Prints the board's current state to the console. */
         void render() const;
+        /** Gets a copy of the board's simulation state alone (its cells, shells and tanks), for playing
+         * rounds ahead without touching the real game: the copy does not report on the console, and does
+         * not track its dirty cells. */
+        Board clone() const;
+        /** Writes the board's simulation state (its cells, shells and tanks, as clone() copies them) to
+         * the given binary stream (see BinaryIO). */
+        void writeState(std::ostream& out) const;
+        /** Reads a board written by writeState() from the given binary stream. Like a clone, it does not
+         * report on the console, and does not track its dirty cells. Throws a runtime_error if the stream
+         * ends too early. */
+        static Board readState(std::istream& in);
         /** Gets the X coordinate of an (X, Y) coordinate's neighbor in the given direction.  */
         int getNeighborXCoord(int currentX, int deltaX);
         /** Gets the Y coordinate of an (X, Y) coordinate's neighbor in the given direction.  */
@@ -102,22 +219,16 @@ class Board {
         void placeWall(std::pair<int, int> pos);
         /** Places a mine on the board. */
         void placeMine(std::pair<int, int> pos);
-        /** Creates a new vertex and adds it to the map of all the vertices the board consists of. */
-        void addNewVertexToMap(int X, int Y, bool is_wall = false, bool is_mine = false);
-        /** Adds a pre-created vertex to the map of all the vertices the board consists of. */
-        void addExistingVertexToMap(Vertex vertex);
-        /** Initializes the board. */
-        void initializeBoard();
         /** Creates a new shell at the given (X, Y) coordinates, which moves in the given direction, and
-         * adds it to the vector denoting all shells on the board. */
+         * adds it to the pool of all shells on the board. */
         void addNewShell(int X, int Y, Direction dir);
         /** Removes an existing shell from the vector depicting all shells on the board, and destroying
          * it. */
-        void removeShell(const Shell& shell);
+        void removeShell(int shellInd);
         /** Checks if the BFS path is safe. */
         // bool isBFSPathSafe();
         /** Moves a shell on the board. */
-        void moveShell(Shell& shell);
+        void moveShell(int shellInd);
         /** Moves all the shells on the board. */
         void moveAllShells();
         /** Checks if a certain position on the board is already occupied. */
@@ -134,7 +245,15 @@ class Board {
         bool shoot(int tankInd);
         bool rotate(ActionRequest action, int tankInd);
         bool act(ActionRequest action, int tankInd);
-        vector<pair<size_t, size_t>> updateObjectsOnBoard();
+        /** Resolves the collisions of all the objects on the board after they have moved. */
+        void updateObjectsOnBoard();
+        /** Empties the dirty-cell list, once its changes have been passed on (see getDirtyCells()). */
+        void clearDirtyCells();
+        /** Gets a 64-bit Zobrist hash of the board's state: its cells, its shells (with their directions)
+         * and its living tanks (with everything their next moves depend on). Equal states always hash
+         * the same, and different ones almost never do. Only the cells edited since the last call are
+         * rehashed, and the shells, which all move every round. */
+        std::uint64_t hashState();
         bool isTankAlive(int tankInd);
         bool tankHasAmmo(int tankInd);
 };
\ No newline at end of file
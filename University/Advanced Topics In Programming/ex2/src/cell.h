@@ -0,0 +1,57 @@
+/**
+ * @file cell.h
+ * @brief A file depicting the byte encoding of a single cell on the board.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#pragma once
+#include <cstdint>
+#include <string>
+
+/** A single board cell. Each bit marks one kind of object occupying the cell, and the top 2 bits hold
+ * the number of hits a wall on this cell has taken. */
+using Cell = std::uint8_t;
+
+namespace CellFlag {
+    constexpr Cell EMPTY = 0;
+    constexpr Cell WALL = 1 << 0;
+    constexpr Cell MINE = 1 << 1;
+    constexpr Cell SHELL = 1 << 2;
+    constexpr Cell TANK_A = 1 << 3;
+    constexpr Cell TANK_B = 1 << 4;
+    constexpr Cell TANK = TANK_A | TANK_B;
+    constexpr int WALL_HP_SHIFT = 6;
+    constexpr Cell WALL_HP = 3 << WALL_HP_SHIFT;
+}
+
+/** Gets the tank flag matching the given player index. */
+inline Cell tankFlagOf(int player_ind) {
+    return (player_ind == 1) ? CellFlag::TANK_A : CellFlag::TANK_B;
+}
+
+/** Gets the number of hits the wall on the given cell has taken. */
+inline int cellWallHP(Cell cell) {
+    return (cell & CellFlag::WALL_HP) >> CellFlag::WALL_HP_SHIFT;
+}
+
+/** Sets the number of hits the wall on the given cell has taken. */
+inline void setCellWallHP(Cell& cell, int hp) {
+    cell = static_cast<Cell>((cell & ~CellFlag::WALL_HP) | ((hp << CellFlag::WALL_HP_SHIFT) & CellFlag::WALL_HP));
+}
+
+/** Gets the character the satellite view reports for the given cell. */
+inline char cellToChar(Cell cell) {
+    if (cell & CellFlag::SHELL) { return '*'; }
+    if (cell & CellFlag::TANK_A) { return '1'; }
+    if (cell & CellFlag::TANK_B) { return '2'; }
+    if (cell & CellFlag::WALL) { return '#'; }
+    if (cell & CellFlag::MINE) { return '@'; }
+    return ' ';
+}
+
+/** Gets the string the board's console rendering prints for the given cell. */
+inline std::string cellToString(Cell cell) {
+    if (cell & CellFlag::SHELL) { return (cell & CellFlag::MINE) ? "*@" : "*"; }
+    char c = cellToChar(cell);
+    return (c == ' ') ? "." : std::string(1, c);
+}
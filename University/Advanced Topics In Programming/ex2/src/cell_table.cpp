@@ -0,0 +1,35 @@
+/**
+ * @file cell_table.cpp
+ * @brief A file detailing the implementation of all the functions declared in cell_table.h.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#include "cell_table.h"
+#include <algorithm>
+using namespace std;
+
+/* ------------------------------------------ CONSTRUCTORS: ------------------------------------------ */
+
+CellTable::CellTable() {
+    keys_ = vector<int>(1, -1);
+    values_ = vector<int>(1, 0);
+    mask_ = 0;
+    default_ = 0;
+}
+
+/* ----------------------------------------- OTHER FUNCTIONS: ---------------------------------------- */
+
+void CellTable::clear(size_t cells, int default_value) {
+    /* At most a quarter full, so probes stay short, and never full, so every probe ends. The table is
+     * only reallocated if it is too small, or so large that emptying it would cost more than using it. */
+    size_t slots = 4;
+    while (slots < 4 * cells) { slots *= 2; }
+    if (keys_.size() < slots || keys_.size() > 16 * slots) {
+        keys_.assign(slots, -1);
+        values_.assign(slots, 0);
+    } else {
+        fill(keys_.begin(), keys_.end(), -1);
+    }
+    mask_ = static_cast<uint32_t>(keys_.size() - 1);
+    default_ = default_value;
+}
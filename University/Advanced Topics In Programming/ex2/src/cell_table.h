@@ -0,0 +1,59 @@
+/**
+ * @file cell_table.h
+ * @brief A file depicting the CellTable class declaration.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/** A small open-addressing map from cell indices to integers, sized for the number of cells it will hold
+ * rather than for the whole board. The board fills one every half-round with the few cells its shells and
+ * tanks are on, so that finding which of them share a cell stays within a table that fits in the cache,
+ * instead of scattering over per-cell arrays as large as the board. Cells never set read as the table's
+ * default value. */
+class CellTable {
+    private:
+        std::vector<int> keys_;        /* The cell held in each slot, or -1 if it is empty. */
+        std::vector<int> values_;
+        std::uint32_t mask_;
+        int default_;
+
+        /** Gets the slot holding the given cell, or the empty slot it would be placed in. */
+        std::size_t findSlot(int cell) const {
+            std::size_t slot = (static_cast<std::uint32_t>(cell) * 0x9E3779B1u) & mask_;
+            while (keys_[slot] != cell && keys_[slot] != -1) { slot = (slot + 1) & mask_; }
+            return slot;
+        }
+
+    public:
+        /* -------------------------------------- CONSTRUCTORS: -------------------------------------- */
+
+        /** Default Constructor, making an empty table that must be cleared before use. */
+        CellTable();
+
+        /* ----------------------------------------- GETTERS: ---------------------------------------- */
+
+        /** Gets the value of the given cell, or the default value if it was never set. */
+        int get(int cell) const {
+            std::size_t slot = findSlot(cell);
+            return (keys_[slot] == cell) ? values_[slot] : default_;
+        }
+
+        /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
+
+        /** Empties the table, making room for up to the given number of cells without slowing down, all
+         * of which read as the given default value until they are set. Keeps the table's capacity. */
+        void clear(std::size_t cells, int default_value);
+        /** Gets a writable reference to the value of the given cell, adding it with the default value if
+         * it is not in the table yet. The table must have room for it (see clear()). */
+        int& edit(int cell) {
+            std::size_t slot = findSlot(cell);
+            if (keys_[slot] == -1) {
+                keys_[slot] = cell;
+                values_[slot] = default_;
+            }
+            return values_[slot];
+        }
+};
@@ -48,69 +48,60 @@ inline Direction stringToDirection(const std::string& str) {
     throw std::invalid_argument("Invalid direction string: " + str);
 }
 
-inline int directionToIndex(Direction dir) {
-    switch (dir) {
-        case Direction::U:  return 0;
-        case Direction::UR: return 1;
-        case Direction::R:  return 2;
-        case Direction::DR: return 3;
-        case Direction::D:  return 4;
-        case Direction::DL: return 5;
-        case Direction::L:  return 6;
-        case Direction::UL: return 7;
-        default: throw std::invalid_argument("Unknown direction");
-    }
+/* The directions in their index order (see directionToIndex()), and each one's (row, column) delta. */
+inline constexpr Direction DIRECTIONS[8] = {
+    Direction::U, Direction::UR, Direction::R, Direction::DR,
+    Direction::D, Direction::DL, Direction::L, Direction::UL
+};
+inline constexpr std::pair<int, int> DIRECTION_DELTAS[8] = {
+    {-1, 0}, {-1, 1}, {0, 1}, {1, 1}, {1, 0}, {1, -1}, {0, -1}, {-1, -1}
+};
+
+// The enumerators are declared in index order, so converting between the two is a cast
+constexpr int directionToIndex(Direction dir) {
+    int index = static_cast<int>(dir);
+    if (index < 0 || index >= 8) { throw std::invalid_argument("Unknown direction"); }
+    return index;
 }
 
-inline Direction indexToDirection(int index) {
-    if (index == 0)  return Direction::U;
-    if (index == 1) return Direction::UR;
-    if (index == 2)  return Direction::R;
-    if (index == 3) return Direction::DR;
-    if (index == 4)  return Direction::D;
-    if (index == 5) return Direction::DL;
-    if (index == 6)  return Direction::L;
-    if (index == 7) return Direction::UL;
-    throw std::invalid_argument("Invalid index for direction");
+constexpr Direction indexToDirection(int index) {
+    if (index < 0 || index >= 8) { throw std::invalid_argument("Invalid index for direction"); }
+    return DIRECTIONS[index];
 }
 
-inline std::pair<int, int> directionToDelta(Direction dir) {
-    switch (dir) {
-        case Direction::U:  return {-1, 0};
-        case Direction::UR: return {-1, 1};
-        case Direction::R:  return {0, 1};
-        case Direction::DR: return {1, 1};
-        case Direction::D:  return {1, 0};
-        case Direction::DL: return {1, -1};
-        case Direction::L:  return {0, -1};
-        case Direction::UL: return {-1, -1};
-        default: throw std::invalid_argument("Unknown direction");
-    }
+constexpr std::pair<int, int> directionToDelta(Direction dir) {
+    return DIRECTION_DELTAS[directionToIndex(dir)];
 }
 
-inline Direction rotateRightQuarter(Direction dir) {
-    int index = directionToIndex(dir);
-    return indexToDirection((index + 2) % 8);
+// Rotating is adding to the index modulo 8, and 8 is a power of 2
+constexpr Direction rotateRightQuarter(Direction dir) {
+    return DIRECTIONS[(directionToIndex(dir) + 2) & 7];
 }
 
-inline Direction rotateLeftQuarter(Direction dir) {
-    int index = directionToIndex(dir);
-    return indexToDirection((index + 6) % 8);  // Equivalent to -2 mod 8
+constexpr Direction rotateLeftQuarter(Direction dir) {
+    return DIRECTIONS[(directionToIndex(dir) + 6) & 7];  // Equivalent to -2 mod 8
 }
 
-inline Direction rotateRightEighth(Direction dir) {
-    int index = directionToIndex(dir);
-    return indexToDirection((index + 1) % 8);
+constexpr Direction rotateRightEighth(Direction dir) {
+    return DIRECTIONS[(directionToIndex(dir) + 1) & 7];
 }
 
-inline Direction rotateLeftEighth(Direction dir) {
-    int index = directionToIndex(dir);
-    return indexToDirection((index + 7) % 8);  // Equivalent to -1 mod 8
+constexpr Direction rotateLeftEighth(Direction dir) {
+    return DIRECTIONS[(directionToIndex(dir) + 7) & 7];  // Equivalent to -1 mod 8
 }
 
-inline pair<int, int> getNextCoordsInDir(Direction dir, pair<int, int> prevCoords, int rows, int cols) {
+// A step moves at most 1 cell on each axis, so wrapping around the board never needs a division
+constexpr pair<int, int> getNextCoordsInDir(Direction dir, pair<int, int> prevCoords, int rows, int cols) {
     pair<int, int> delta = directionToDelta(dir);
-    int newRow = (prevCoords.first + delta.first + rows) % rows;
-    int newCol = (prevCoords.second + delta.second + cols) % cols;
+    int newRow = prevCoords.first + delta.first;
+    int newCol = prevCoords.second + delta.second;
+    if (newRow < 0) { newRow += rows; }
+    else if (newRow >= rows) { newRow -= rows; }
+    if (newCol < 0) { newCol += cols; }
+    else if (newCol >= cols) { newCol -= cols; }
     return {newRow, newCol};
-}
\ No newline at end of file
+}
+
+static_assert(rotateRightQuarter(Direction::UL) == Direction::UR);
+static_assert(rotateLeftEighth(Direction::U) == Direction::UL);
+static_assert(getNextCoordsInDir(Direction::UL, {0, 0}, 3, 4) == pair<int, int>(2, 3));
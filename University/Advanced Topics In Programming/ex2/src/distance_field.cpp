@@ -0,0 +1,106 @@
+/**
+ * @file distance_field.cpp
+ * @brief A file detailing the implementation of all the functions declared in distance_field.h.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#include "distance_field.h"
+using namespace std;
+
+/* ------------------------------------------ CONSTRUCTORS: ------------------------------------------ */
+
+DistanceField::DistanceField() {
+    rows_ = 0;
+    columns_ = 0;
+    dis_ = vector<int>();
+}
+
+DistanceField::DistanceField(const vector<vector<char>>& grid, const vector<pair<int, int>>& sources)
+    : DistanceField(grid, sources,
+        *NeighborTable::getShared(grid.size(), grid.empty() ? 0 : grid[0].size())) {}
+
+DistanceField::DistanceField(const vector<vector<char>>& grid, const vector<pair<int, int>>& sources,
+    const NeighborTable& neighbors) {
+    rows_ = grid.size();
+    columns_ = grid.empty() ? 0 : grid[0].size();
+    dis_.assign(static_cast<size_t>(rows_) * columns_, -1);
+
+    /* The whole grid is searched, so its walls '#' and mines '@' are first read into a flat array. */
+    vector<unsigned char> blocked(dis_.size());
+    for (int row = 0; row < rows_; row++) {
+        for (int col = 0; col < columns_; col++) {
+            blocked[row * columns_ + col] = (grid[row][col] == '#' || grid[row][col] == '@');
+        }
+    }
+
+    vector<int> Q;
+    Q.reserve(dis_.size());
+    for (const auto& source : sources) {
+        if (source.first < 0 || source.first >= rows_ || source.second < 0 || source.second >= columns_) {
+            continue;
+        }
+        int index = source.first * columns_ + source.second;
+        if (dis_[index] == -1) {
+            dis_[index] = 0;
+            Q.push_back(index);
+        }
+    }
+
+    for (size_t head = 0; head < Q.size(); ++head) {
+        int u = Q[head];
+        const int* u_neighbors = neighbors.getNeighbors(u);
+        for (int dir_idx = 0; dir_idx < 8; dir_idx++) {
+            int v = u_neighbors[dir_idx];
+            if (blocked[v]) { continue; }
+            if (dis_[v] == -1) {
+                dis_[v] = dis_[u] + 1;
+                Q.push_back(v);
+            }
+        }
+    }
+}
+
+/* --------------------------------------------- GETTERS: -------------------------------------------- */
+
+int DistanceField::getRows() const {
+    return rows_;
+}
+
+int DistanceField::getColumns() const {
+    return columns_;
+}
+
+int DistanceField::getDis(pair<int, int> pos) const {
+    if (pos.first < 0 || pos.first >= rows_ || pos.second < 0 || pos.second >= columns_) { return -1; }
+    return dis_[pos.first * columns_ + pos.second];
+}
+
+/* ----------------------------------------- OTHER FUNCTIONS: ---------------------------------------- */
+
+bool DistanceField::reachable(pair<int, int> pos) const {
+    return getDis(pos) != -1;
+}
+
+pair<int, int> DistanceField::nextStep(pair<int, int> pos) const {
+    int dis = getDis(pos);
+    if (dis <= 0) { return pos; }
+    for (int dir_idx = 0; dir_idx < 8; dir_idx++) {
+        pair<int, int> neighbor = getNextCoordsInDir(indexToDirection(dir_idx), pos, rows_, columns_);
+        if (getDis(neighbor) == dis - 1) { return neighbor; }
+    }
+    return pos;
+}
+
+vector<pair<int, int>> DistanceField::pathFrom(pair<int, int> pos) const {
+    vector<pair<int, int>> path;
+    int dis = getDis(pos);
+    if (dis == -1) { return path; }
+    path.reserve(dis + 1);
+    path.push_back(pos);
+    while (dis > 0) {
+        pos = nextStep(pos);
+        path.push_back(pos);
+        dis--;
+    }
+    return path;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file distance_field.h
+ * @brief A file depicting the DistanceField class declaration.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#pragma once
+#include <vector>
+#include "direction.h"
+#include "neighbor_table.h"
+
+/** The BFS distance from every cell of the toroidal board to the nearest of a set of source cells, found
+ * by a single multi-source BFS. A player builds one from all the enemy positions it sees and shares it
+ * between all of its tanks, each of which can then read its next step toward the nearest enemy in O(1)
+ * instead of running its own BFS. Walls ('#') and mines ('@') cannot be stepped on. */
+class DistanceField {
+    private:
+        int rows_;
+        int columns_;
+        std::vector<int> dis_;
+
+    public:
+        /* -------------------------------------- CONSTRUCTORS: -------------------------------------- */
+
+        /** Default Constructor. */
+        DistanceField();
+        /** Builds the distance field of the given grid from the given source positions. */
+        DistanceField(const std::vector<std::vector<char>>& grid, const std::vector<std::pair<int, int>>& sources);
+        /** Builds the distance field of the given grid from the given source positions, stepping through
+         * the given neighbor table, which must match the grid's dimensions. */
+        DistanceField(const std::vector<std::vector<char>>& grid, const std::vector<std::pair<int, int>>& sources,
+            const NeighborTable& neighbors);
+
+        /* ----------------------------------------- GETTERS: ---------------------------------------- */
+
+        /** Gets the number of rows in the field. */
+        int getRows() const;
+        /** Gets the number of columns in the field. */
+        int getColumns() const;
+        /** Gets the distance from the given (X, Y) coordinates to the nearest source, or -1 if no source
+         * can be reached from them. */
+        int getDis(std::pair<int, int> pos) const;
+
+        /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
+
+        /** Checks if a source can be reached from the given (X, Y) coordinates. */
+        bool reachable(std::pair<int, int> pos) const;
+        /** Gets the neighbor of the given (X, Y) coordinates that is one step closer to the nearest
+         * source, preferring directions in their index order. Returns the given coordinates if they are
+         * a source or no source can be reached from them. */
+        std::pair<int, int> nextStep(std::pair<int, int> pos) const;
+        /** Gets the path (in (X, Y) coordinates) from the given coordinates to the nearest source by
+         * following nextStep(), or an empty path if no source can be reached from them. */
+        std::vector<std::pair<int, int>> pathFrom(std::pair<int, int> pos) const;
+};
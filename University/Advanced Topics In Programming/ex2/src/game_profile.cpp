@@ -0,0 +1,193 @@
+/**
+ * @file game_profile.cpp
+ * @brief A file detailing the implementation of all the functions declared in game_profile.h.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#include "game_profile.h"
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+using namespace std;
+
+namespace {
+    double toMilliseconds(GameProfile::Clock::duration time) {
+        return chrono::duration<double, milli>(time).count();
+    }
+
+    /** Gets the CSV metric of the given table name: lower case, with underscores between words. */
+    string toMetric(const string& name) {
+        string metric;
+        for (char c : name) {
+            unsigned char letter = static_cast<unsigned char>(c);
+            if (isalnum(letter)) { metric += static_cast<char>(tolower(letter)); }
+            else if (!metric.empty() && metric.back() != '_') { metric += '_'; }
+        }
+        while (!metric.empty() && metric.back() == '_') { metric.pop_back(); }
+        return metric;
+    }
+}
+
+/* ------------------------------------------ CONSTRUCTORS: ------------------------------------------ */
+
+GameProfile::GameProfile() {
+    phaseTimes_.fill(Clock::duration::zero());
+    phaseCalls_.fill(0);
+    totalTime_ = Clock::duration::zero();
+    halfRounds_ = 0;
+    shellsAlive_ = 0;
+    peakShellsAlive_ = 0;
+    actions_ = 0;
+    ignoredActions_ = 0;
+    battleInfoCalls_.fill(0);
+    bfsRuns_ = 0;
+    pathsSearched_ = 0;
+    pathsReused_ = 0;
+    distanceFieldsBuilt_ = 0;
+    distanceFieldLookups_ = 0;
+}
+
+/* --------------------------------------------- GETTERS: -------------------------------------------- */
+
+GameProfile::Clock::duration GameProfile::getPhaseTime(Phase phase) const {
+    return phaseTimes_[phase];
+}
+
+unsigned long GameProfile::getPhaseCalls(Phase phase) const {
+    return phaseCalls_[phase];
+}
+
+GameProfile::Clock::duration GameProfile::getTotalTime() const {
+    return totalTime_;
+}
+
+unsigned long GameProfile::getHalfRounds() const {
+    return halfRounds_;
+}
+
+unsigned long GameProfile::getBattleInfoCalls(int player_index) const {
+    return battleInfoCalls_[player_index - 1];
+}
+
+unsigned long GameProfile::getBfsRuns() const {
+    return bfsRuns_;
+}
+
+unsigned long GameProfile::getDistanceFieldsBuilt() const {
+    return distanceFieldsBuilt_;
+}
+
+string GameProfile::getPhaseName(Phase phase) {
+    switch (phase) {
+        case SHELL_MOVEMENT:        return "Shell movement";
+        case COLLISIONS:            return "Collisions";
+        case SATELLITE_REFRESH:     return "Satellite refresh";
+        case PLAYER_1_DECISIONS:    return "Player 1 decisions";
+        case PLAYER_2_DECISIONS:    return "Player 2 decisions";
+        case PARALLEL_DECISIONS:    return "Parallel decisions";
+        case TANK_ACTIONS:          return "Tank actions";
+        case REPETITION_CHECK:      return "Repetition check";
+        case LOGGING:               return "Logging";
+        default:                    return "Unknown";
+    }
+}
+
+/* ----------------------------------------- OTHER FUNCTIONS: ---------------------------------------- */
+
+void GameProfile::addTotalTime(Clock::duration time) {
+    totalTime_ += time;
+}
+
+void GameProfile::countHalfRound(size_t shells_alive) {
+    halfRounds_++;
+    shellsAlive_ += shells_alive;
+    peakShellsAlive_ = max<unsigned long>(peakShellsAlive_, shells_alive);
+}
+
+void GameProfile::countAction(bool ignored) {
+    actions_++;
+    if (ignored) { ignoredActions_++; }
+}
+
+void GameProfile::countBattleInfo(int player_index) {
+    battleInfoCalls_[player_index - 1]++;
+}
+
+void GameProfile::setSearches(unsigned long bfs_runs, unsigned long paths_searched,
+    unsigned long paths_reused, unsigned long distance_fields_built,
+    unsigned long distance_field_lookups) {
+    bfsRuns_ = bfs_runs;
+    pathsSearched_ = paths_searched;
+    pathsReused_ = paths_reused;
+    distanceFieldsBuilt_ = distance_fields_built;
+    distanceFieldLookups_ = distance_field_lookups;
+}
+
+vector<GameProfile::Count> GameProfile::getCounts() const {
+    double average_shells = halfRounds_ == 0 ? 0.0 : static_cast<double>(shellsAlive_) / halfRounds_;
+    return {
+        {"Half-rounds", static_cast<double>(halfRounds_), 0},
+        {"Shells alive (average)", average_shells, 2},
+        {"Shells alive (peak)", static_cast<double>(peakShellsAlive_), 0},
+        {"Tank actions", static_cast<double>(actions_), 0},
+        {"Ignored actions", static_cast<double>(ignoredActions_), 0},
+        {"Player 1 GetBattleInfo calls", static_cast<double>(battleInfoCalls_[0]), 0},
+        {"Player 2 GetBattleInfo calls", static_cast<double>(battleInfoCalls_[1]), 0},
+        {"BFS runs", static_cast<double>(bfsRuns_), 0},
+        {"Paths searched", static_cast<double>(pathsSearched_), 0},
+        {"Paths reused", static_cast<double>(pathsReused_), 0},
+        {"Distance fields built", static_cast<double>(distanceFieldsBuilt_), 0},
+        {"Distance field lookups", static_cast<double>(distanceFieldLookups_), 0}
+    };
+}
+
+void GameProfile::writeTable(ostream& out) const {
+    double total = toMilliseconds(totalTime_);
+    Clock::duration other = totalTime_;
+    auto share = [total](double time) { return total <= 0 ? 0.0 : 100.0 * time / total; };
+    auto writePhase = [&](const string& name, double time, const string& calls) {
+        out << left << setw(30) << name << right << setw(12) << setprecision(3) << time << setw(9)
+            << setprecision(1) << share(time) << '%' << setw(10) << calls << '\n';
+    };
+
+    ios::fmtflags flags = out.flags();
+    streamsize precision = out.precision();
+    out << fixed;
+    out << left << setw(30) << "Phase" << right << setw(12) << "Time (ms)" << setw(10) << "Share"
+        << setw(10) << "Calls" << '\n';
+    for (int phase = 0; phase < PHASES; ++phase) {
+        if (phaseCalls_[phase] == 0) { continue; }
+        writePhase(getPhaseName(static_cast<Phase>(phase)), toMilliseconds(phaseTimes_[phase]),
+            to_string(phaseCalls_[phase]));
+        other -= phaseTimes_[phase];
+    }
+    /* The phases never overlap, so whatever is left is the round loop's own bookkeeping. */
+    writePhase("Other", toMilliseconds(max(other, Clock::duration::zero())), "");
+    writePhase("Total", total, "");
+
+    out << '\n' << left << setw(30) << "Count" << right << setw(12) << "Value" << '\n';
+    for (const Count& count : getCounts()) {
+        out << left << setw(30) << count.name << right << setw(12) << setprecision(count.precision)
+            << count.value << '\n';
+    }
+    out.flags(flags);
+    out.precision(precision);
+}
+
+void GameProfile::writeCsv(ostream& out) const {
+    ios::fmtflags flags = out.flags();
+    streamsize precision = out.precision();
+    out << "metric,value\n" << fixed << setprecision(3);
+    for (int phase = 0; phase < PHASES; ++phase) {
+        string metric = toMetric(getPhaseName(static_cast<Phase>(phase)));
+        out << "time_ms." << metric << ',' << toMilliseconds(phaseTimes_[phase]) << '\n';
+        out << "calls." << metric << ',' << phaseCalls_[phase] << '\n';
+    }
+    out << "time_ms.total," << toMilliseconds(totalTime_) << '\n';
+    for (const Count& count : getCounts()) {
+        out << "count." << toMetric(count.name) << ',' << setprecision(count.precision) << count.value
+            << '\n';
+    }
+    out.flags(flags);
+    out.precision(precision);
+}
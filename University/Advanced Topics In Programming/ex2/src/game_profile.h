@@ -0,0 +1,115 @@
+/**
+ * @file game_profile.h
+ * @brief A file depicting the GameProfile class declaration.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/** Where a profiled game's time went, and how much work it did. The game manager adds up the wall time of
+ * every phase of every round into it, along with counts of the shells, actions and searches it went
+ * through, and it is printed as a table, or as CSV, once the game is over (see
+ * GameManager::setProfiling()). */
+class GameProfile {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /** The parts of a round timed separately. */
+        enum Phase {
+            SHELL_MOVEMENT,         /* Board::moveAllShells(). */
+            COLLISIONS,             /* Board::updateObjectsOnBoard(), after the shells and the tanks. */
+            SATELLITE_REFRESH,      /* Passing the board's changes on to the satellite view. */
+            PLAYER_1_DECISIONS,     /* Player 1's tanks' getAction() and battle info. */
+            PLAYER_2_DECISIONS,     /* Player 2's tanks' getAction() and battle info. */
+            PARALLEL_DECISIONS,     /* All the tanks' getAction(), when they decide in parallel. */
+            TANK_ACTIONS,           /* Board::act(). */
+            REPETITION_CHECK,       /* Counting the board's states to end repeated games. */
+            LOGGING,                /* The output log, and all the printing to the console. */
+            PHASES
+        };
+
+    private:
+        std::array<Clock::duration, PHASES> phaseTimes_;
+        std::array<unsigned long, PHASES> phaseCalls_;
+        Clock::duration totalTime_;
+        unsigned long halfRounds_;
+        unsigned long shellsAlive_;         /* Summed over all half-rounds, as they started. */
+        unsigned long peakShellsAlive_;
+        unsigned long actions_;
+        unsigned long ignoredActions_;
+        std::array<unsigned long, 2> battleInfoCalls_;
+        unsigned long bfsRuns_;
+        unsigned long pathsSearched_;
+        unsigned long pathsReused_;
+        unsigned long distanceFieldsBuilt_;
+        unsigned long distanceFieldLookups_;
+
+        /** A count as printed: its name in the table, its value and the number of decimals shown. */
+        struct Count {
+            std::string name;
+            double value;
+            int precision;
+        };
+
+        /** Gets every count kept beside the phases' times, in the order they are printed. */
+        std::vector<Count> getCounts() const;
+
+    public:
+        /* -------------------------------------- CONSTRUCTORS: -------------------------------------- */
+
+        /** Default Constructor, with nothing timed or counted yet. */
+        GameProfile();
+
+        /* ----------------------------------------- GETTERS: ---------------------------------------- */
+
+        /** Gets the wall time spent in the given phase. */
+        Clock::duration getPhaseTime(Phase phase) const;
+        /** Gets the number of times the given phase was timed. */
+        unsigned long getPhaseCalls(Phase phase) const;
+        /** Gets the wall time of the whole game, from its first round to its end. */
+        Clock::duration getTotalTime() const;
+        /** Gets the number of half-rounds played. */
+        unsigned long getHalfRounds() const;
+        /** Gets the number of GetBattleInfo requests made by the given player's (1 or 2) tanks. */
+        unsigned long getBattleInfoCalls(int player_index) const;
+        /** Gets the number of breadth-first searches the tanks ran for paths of their own (see
+         * BaseTankAlgorithm::findPath()). The distance fields built are counted apart. */
+        unsigned long getBfsRuns() const;
+        /** Gets the number of distance fields the players built (see BasePlayer::getDistanceField()). */
+        unsigned long getDistanceFieldsBuilt() const;
+        /** Gets the name of the given phase, as printed in the table. */
+        static std::string getPhaseName(Phase phase);
+
+        /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
+
+        /** Adds the given wall time to the given phase. */
+        void addTime(Phase phase, Clock::duration time) {
+            phaseTimes_[phase] += time;
+            phaseCalls_[phase]++;
+        }
+        /** Adds the given wall time to the whole game's. */
+        void addTotalTime(Clock::duration time);
+        /** Counts a half-round starting with the given number of shells in flight. */
+        void countHalfRound(std::size_t shells_alive);
+        /** Counts an action applied to the board, ignored or not. */
+        void countAction(bool ignored);
+        /** Counts a GetBattleInfo request by one of the given player's (1 or 2) tanks. */
+        void countBattleInfo(int player_index);
+        /** Sets the game's search counts: its tanks' breadth-first searches, the paths they searched for
+         * and reused (see BaseTankAlgorithm::findPath()), and the distance fields its players built and
+         * were asked for (see BasePlayer::getDistanceField()). */
+        void setSearches(unsigned long bfs_runs, unsigned long paths_searched, unsigned long paths_reused,
+            unsigned long distance_fields_built, unsigned long distance_field_lookups);
+        /** Writes every phase's time, share of the game and number of calls, and then every count, as an
+         * aligned table. Time spent outside of every phase is listed as "Other". */
+        void writeTable(std::ostream& out) const;
+        /** Writes the same figures as writeTable(), as "metric,value" lines under a header line, with the
+         * times in milliseconds. */
+        void writeCsv(std::ostream& out) const;
+};
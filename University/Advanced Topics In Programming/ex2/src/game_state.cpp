@@ -0,0 +1,128 @@
+/**
+ * @file game_state.cpp
+ * @brief A file detailing the implementation of all the functions declared in game_state.h.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#include "game_state.h"
+#include "binary_io.h"
+using namespace std;
+
+/* ------------------------------------------ CONSTRUCTORS: ------------------------------------------ */
+
+GameState::GameState() {
+    board_ = Board();
+    rounds_ = 0;
+    maxRounds_ = 0;
+    roundsWithoutAmmo_ = 0;
+    ammoLeft_ = false;
+    winner_ = -1;
+}
+
+GameState::GameState(Board board, int rounds, int max_rounds, int rounds_without_ammo, bool ammo_left,
+    int winner)
+    : board_(std::move(board)), rounds_(rounds), maxRounds_(max_rounds),
+      roundsWithoutAmmo_(rounds_without_ammo), ammoLeft_(ammo_left), winner_(winner) {}
+
+/* -------------------------------------------- OPERATORS: ------------------------------------------- */
+
+bool GameState::operator==(const GameState& game_state) const {
+    return (board_ == game_state.getBoard() && rounds_ == game_state.getRounds() &&
+        maxRounds_ == game_state.getMaxRounds() && roundsWithoutAmmo_ == game_state.getRoundsWithoutAmmo() &&
+        ammoLeft_ == game_state.ammoLeft() && winner_ == game_state.getWinner());
+}
+
+bool GameState::operator!=(const GameState& game_state) const {
+    return !(*this == game_state);
+}
+
+/* --------------------------------------------- GETTERS: -------------------------------------------- */
+
+const Board& GameState::getBoard() const {
+    return board_;
+}
+
+Board& GameState::getBoard() {
+    return board_;
+}
+
+int GameState::getRounds() const {
+    return rounds_;
+}
+
+int GameState::getMaxRounds() const {
+    return maxRounds_;
+}
+
+int GameState::getRoundsWithoutAmmo() const {
+    return roundsWithoutAmmo_;
+}
+
+bool GameState::ammoLeft() const {
+    return ammoLeft_;
+}
+
+int GameState::getWinner() const {
+    return winner_;
+}
+
+bool GameState::gameOver() const {
+    return winner_ != -1;
+}
+
+/* ----------------------------------------- OTHER FUNCTIONS: ---------------------------------------- */
+
+bool GameState::checkWinner() {
+    int tanksA = board_.getPlayerATanks();
+    int tanksB = board_.getPlayerBTanks();
+    if (tanksA == 0 && tanksB == 0) { winner_ = 0; }
+    else if (tanksA == 0) { winner_ = 2; }
+    else if (tanksB == 0) { winner_ = 1; }
+    return gameOver();
+}
+
+bool GameState::step(const vector<ActionRequest>& actions) {
+    for (int half = 0; half < 2 && !gameOver(); ++half) {
+        /* The same limits as in GameManager::run(), which ends in a tie once either is reached. */
+        if (rounds_ >= maxRounds_ * 2 || roundsWithoutAmmo_ >= 80) {
+            winner_ = 0;
+            break;
+        }
+        board_.moveAllShells();
+        board_.updateObjectsOnBoard();
+        if (checkWinner()) { break; }
+        if (rounds_ % 2 == 0) {
+            ammoLeft_ = false;
+            for (int tankInd = 0; tankInd < board_.getNumTanks(); ++tankInd) {
+                if (!board_.isTankAlive(tankInd)) { continue; }
+                ActionRequest action = (static_cast<size_t>(tankInd) < actions.size()) ?
+                    actions[tankInd] : ActionRequest::DoNothing;
+                if (action != ActionRequest::GetBattleInfo) { board_.act(action, tankInd); }
+                if (board_.tankHasAmmo(tankInd)) { ammoLeft_ = true; }
+            }
+            board_.updateObjectsOnBoard();
+            if (checkWinner()) { break; }
+        }
+        if (!ammoLeft_) { roundsWithoutAmmo_++; }
+        rounds_++;
+    }
+    return gameOver();
+}
+
+void GameState::writeState(ostream& out) const {
+    BinaryIO::writeInt32(out, rounds_);
+    BinaryIO::writeInt32(out, maxRounds_);
+    BinaryIO::writeInt32(out, roundsWithoutAmmo_);
+    BinaryIO::writeUint8(out, ammoLeft_ ? 1 : 0);
+    BinaryIO::writeInt32(out, winner_);
+    board_.writeState(out);
+}
+
+GameState GameState::readState(istream& in) {
+    int rounds = BinaryIO::readInt32(in);
+    int max_rounds = BinaryIO::readInt32(in);
+    int rounds_without_ammo = BinaryIO::readInt32(in);
+    bool ammo_left = BinaryIO::readUint8(in) != 0;
+    int winner = BinaryIO::readInt32(in);
+    return GameState(Board::readState(in), rounds, max_rounds, rounds_without_ammo, ammo_left, winner);
+}
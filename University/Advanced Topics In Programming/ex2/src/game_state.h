@@ -0,0 +1,86 @@
+/**
+ * @file game_state.h
+ * @brief A file depicting the GameState class declaration.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#pragma once
+#include "board.h"
+#include "ActionRequest.h"
+
+/** The simulation state of a game, apart from the GameManager running it: the board (see Board::clone())
+ * and the round counters deciding when the game ends. It holds no logs, factories, players or tank
+ * algorithms, so it is cheap to copy and safe to play forward without affecting the real game. A tank
+ * algorithm looking ahead copies one and calls step() with the actions it wants to try, as many times as
+ * its turn allows. */
+class GameState {
+    private:
+        Board board_;
+        int rounds_;
+        int maxRounds_;
+        int roundsWithoutAmmo_;
+        bool ammoLeft_;
+        int winner_;
+
+        /** Ends the game if either player (or both) has no tanks left. Returns whether the game is over. */
+        bool checkWinner();
+
+    public:
+        /* -------------------------------------- CONSTRUCTORS: -------------------------------------- */
+
+        /** Default constructor. */
+        GameState();
+        /** Constructor with values for all fields. */
+        GameState(Board board, int rounds, int max_rounds, int rounds_without_ammo, bool ammo_left,
+            int winner);
+        /** Default Copy Constructor. */
+        GameState(const GameState& game_state) = default;
+        /** Default Move Constructor. */
+        GameState(GameState&& game_state) noexcept = default;
+        /** Default Deconstructor. */
+        ~GameState() = default;
+
+        /* ---------------------------------------- OPERATORS: --------------------------------------- */
+
+        /** Default Assignment Operator. */
+        GameState& operator=(const GameState& game_state) = default;
+        /** Default Move Assignment Operator. */
+        GameState& operator=(GameState&& game_state) noexcept = default;
+        /** Default Equality Operator. */
+        bool operator==(const GameState& game_state) const;
+        /** Default Inequality Operator. */
+        bool operator!=(const GameState& game_state) const;
+
+        /* ----------------------------------------- GETTERS: ---------------------------------------- */
+
+        /** Gets the board itself. */
+        const Board& getBoard() const;
+        /** Gets a non-const version of the board itself. */
+        Board& getBoard();
+        /** Gets the number of rounds played so far, counting the shells' half-rounds as GameManager::run()
+         * does. */
+        int getRounds() const;
+        /** Gets the maximal number of rounds (as given in the input file). */
+        int getMaxRounds() const;
+        /** Gets the number of rounds played since no tank had any ammo left. */
+        int getRoundsWithoutAmmo() const;
+        /** Checks if any tank had ammo left after the last tank round. */
+        bool ammoLeft() const;
+        /** Gets the index of the player who won the game, 0 if it ended in a tie, or -1 if it is not over
+         * yet. */
+        int getWinner() const;
+        /** Checks if the game is over. */
+        bool gameOver() const;
+
+        /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
+
+        /** Plays one tank turn forward by the rules of GameManager::run(): two of its rounds, in each of
+         * which the shells move, and in the even one of which every alive tank acts. The i-th action is
+         * the i-th tank's (indexed as on the board), and tanks without one do nothing. GetBattleInfo is
+         * treated as doing nothing, as it does not change the board. Returns whether the game is over. */
+        bool step(const std::vector<ActionRequest>& actions);
+        /** Writes the state (its board and its round counters) to the given binary stream. */
+        void writeState(std::ostream& out) const;
+        /** Reads a state written by writeState() from the given binary stream (see Board::readState()). */
+        static GameState readState(std::istream& in);
+};
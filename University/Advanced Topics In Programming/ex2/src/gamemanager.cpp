@@ -5,9 +5,15 @@
  */
 
 #include "gamemanager.h"
+#include "mapped_file.h"
+#include "BaseTankAlgorithm.h"
+#include "BasePlayer.h"
+#include "zobrist.h"
+#include <algorithm>
 #include <sstream>
 #include <fstream>
 #include <filesystem>
+#include <thread>
 namespace fs = std::filesystem;
 using namespace std;
 
@@ -19,9 +25,15 @@ GameManager::GameManager(std::unique_ptr<PlayerFactory> playerFactory, std::uniq
       player1_(nullptr),
       player2_(nullptr),
       gameOver_(false),
+      winner_(-1),
+      rounds_(0),
       maxRounds_(0),
       ammoLeft_(false),
-      roundsWithoutAmmo_(0) {
+      roundsWithoutAmmo_(0),
+      errorFileName_("input_errors.txt"),
+      consoleOutput_(true),
+      repetitionLimit_(0),
+      replayKeyframeInterval_(64) {
     // Initialize satelliteView as a BaseSatelliteView instance
     satelliteView_ = std::make_unique<BaseSatelliteView>();
     tankPlayerIndices_ = std::vector<int>();
@@ -39,8 +51,8 @@ GameManager& GameManager::operator=(const GameManager& game_manager) {
 
 GameManager& GameManager::operator=(GameManager&& game_manager) noexcept {
     if (this != &game_manager) {
-        board_ = game_manager.getBoard();
-        outputFileName_ = game_manager.getOutputFileName();
+        board_ = std::move(game_manager.board_);
+        outputFileName_ = std::move(game_manager.outputFileName_);
         game_manager.resetGameManager();
     }
     return *this;
@@ -56,7 +68,7 @@ bool GameManager::operator!=(const GameManager& game_manager) const {
 
 /* --------------------------------------------- GETTERS: -------------------------------------------- */
 
-Board GameManager::getBoard() const {
+const Board& GameManager::getBoard() const {
     return board_;
 }
 
@@ -64,45 +76,107 @@ string GameManager::getOutputFileName() const {
     return outputFileName_;
 }
 
+int GameManager::getWinner() const {
+    return winner_;
+}
+
+GameState GameManager::cloneState() const {
+    return GameState(board_.clone(), rounds_, maxRounds_, roundsWithoutAmmo_, ammoLeft_, winner_);
+}
+
+const GameProfile* GameManager::getProfile() const {
+    return profile_.get();
+}
+
 /* --------------------------------------------- SETTERS: -------------------------------------------- */
 
 void GameManager::setBoard(Board board) {
-    board_ = board;
+    board_ = std::move(board);
 }
 
 void GameManager::setOutputFileName(string output_file_name) {
     outputFileName_ = output_file_name;
+    outputLog_.close();
+}
+
+void GameManager::setErrorFileName(string error_file_name) {
+    errorFileName_ = std::move(error_file_name);
+    errorLog_.close();
+}
+
+void GameManager::setConsoleOutput(bool console_output) {
+    consoleOutput_ = console_output;
+    board_.setConsoleOutput(console_output);
+}
+
+void GameManager::setRepetitionLimit(int repetition_limit) {
+    repetitionLimit_ = repetition_limit;
+}
+
+void GameManager::setDecisionThreads(int threads) {
+    /* The tanks decide on the pool's threads, so threads beyond the cores would only take turns. */
+    int cores = static_cast<int>(thread::hardware_concurrency());
+    if (cores > 0) { threads = min(threads, cores); }
+    if (threads > 1) { decisionPool_ = make_unique<ThreadPool>(threads); }
+    else { decisionPool_.reset(); }
+}
+
+void GameManager::setUpdateThreads(int threads, size_t min_parallel_shells) {
+    /* Tiles taking turns on fewer cores than threads only add the cost of handing the shells out. */
+    int cores = static_cast<int>(thread::hardware_concurrency());
+    if (cores > 0) { threads = min(threads, cores); }
+    if (threads > 1) { updatePool_ = make_unique<ThreadPool>(threads); }
+    else { updatePool_.reset(); }
+    board_.setThreadPool(updatePool_.get(), min_parallel_shells);
+}
+
+void GameManager::setProfiling(bool profiling) {
+    if (profiling) { profile_ = make_unique<GameProfile>(); }
+    else { profile_.reset(); }
+}
+
+void GameManager::setReplayFile(string replay_file_name, int keyframe_interval) {
+    replayFileName_ = std::move(replay_file_name);
+    replayKeyframeInterval_ = keyframe_interval;
 }
 
 /* ----------------------------------------- OTHER FUNCTIONS: ---------------------------------------- */
 
 void GameManager::readBoard(std::string input_file_name) {
-    vector<string> inputLines = readInputFile(input_file_name);
-    outputFileName_ = getOutputFilename(input_file_name);
-    if (inputLines.empty()) { throw runtime_error("Input is empty"); }
+    /* The file is parsed in a single sweep straight out of its mapping: the header lines first, and then
+     * every row is placed on the board as soon as it is reached. Empty lines are skipped throughout. */
+    MappedFile inputFile(input_file_name);
+    string_view input = inputFile.getContents();
+    setOutputFileName(getOutputFilename(input_file_name));
+    string_view headerLines[5];
+    size_t headerCount = 0;
+    while (headerCount < 5 && MappedFile::nextLine(input, headerLines[headerCount])) { headerCount++; }
+    if (headerCount == 0) { throw runtime_error("Input is empty"); }
     ofstream errorLog;
     bool hasErrors = false;
     auto logError = [&](const string& msg) {
         if (!hasErrors) {
-            errorLog.open("input_errors.txt");
+            errorLog.open(errorFileName_);
             hasErrors = true;
         }
         errorLog << msg << '\n';
     };
 
-    if (inputLines.size() < 6)
+    string_view firstRow;
+    string_view rest = input;
+    if (headerCount < 5 || !MappedFile::nextLine(rest, firstRow))
         throw std::runtime_error("Input file is too short");
 
-    std::string maxStepsLine = inputLines[1];
-    std::string numShellsLine = inputLines[2];
-    std::string rowsLine = inputLines[3];
-    std::string colsLine = inputLines[4];
+    string_view maxStepsLine = headerLines[1];
+    string_view numShellsLine = headerLines[2];
+    string_view rowsLine = headerLines[3];
+    string_view colsLine = headerLines[4];
 
-    auto getNumFromLine = [](const std::string& line) {
+    auto getNumFromLine = [](string_view line) {
         size_t eq = line.find('=');
-        if (eq == std::string::npos)
-            throw std::runtime_error("Line missing '=': " + line);
-        return std::stoi(line.substr(eq + 1));
+        if (eq == string_view::npos)
+            throw std::runtime_error("Line missing '=': " + string(line));
+        return std::stoi(string(line.substr(eq + 1)));
     };
 
     maxRounds_ = getNumFromLine(maxStepsLine);
@@ -110,33 +184,29 @@ void GameManager::readBoard(std::string input_file_name) {
     if (numShells > 0) { ammoLeft_ = true; }
     size_t height = getNumFromLine(rowsLine);
     size_t width = getNumFromLine(colsLine);
-    cout << "===max rounds: " << maxRounds_ << " shells: " << numShells << " height: " << height << " width " << width << "===" << endl;
+    if (consoleOutput_) {
+        cout << "===max rounds: " << maxRounds_ << " shells: " << numShells << " height: " << height << " width " << width << "===" << '\n';
+    }
 
     if (width <= 0 || height <= 0){ throw runtime_error("Invalid board dimentions"); }
 
     board_ = Board(height, width);
+    board_.setConsoleOutput(consoleOutput_);
     satelliteView_->initializeGrid(height, width);
     player1_ = playerFactory_->create(1, height, width, maxRounds_, numShells);
     player2_ = playerFactory_->create(2, height, width, maxRounds_, numShells);
-    int player1Tanks, player2Tanks = 0;
+    int player1Tanks = 0, player2Tanks = 0;
 
     for (size_t row = 0; row < height; ++row) {
-        string line;
-        if (row + 5 >= inputLines.size()) {
+        string_view line;
+        if (!MappedFile::nextLine(input, line)) {
             // Missing row — fill with spaces
-            line = string(width, ' ');
             logError("Missing row at index " + to_string(row));
         }
-        else{
-            line = inputLines[row + 5];
-        }
-
-        if (line.size() < width) {
+        else if (line.size() < width) {
             logError("Row " + to_string(row) + " shorter than declared width. Padding with spaces.");
-            line.append(width - line.size(), ' ');
         } else if (line.size() > width) {
             logError("Row " + to_string(row) + " exceeds declared width. Extra characters will be ignored.");
-            line.resize(width);
         }
 
         for (size_t col = 0; col < width; ++col) {
@@ -180,122 +250,255 @@ void GameManager::readBoard(std::string input_file_name) {
 
     if (player1Tanks == 0 && player2Tanks == 0) {
         writeToOutputLog("Tie, both players have zero tanks");
+        winner_ = 0;
         gameOver_ = true;
     }
     else if(player1Tanks == 0){
         writeToOutputLog("Player 2 won with " + std::to_string(player2Tanks) +" tanks still alive");
+        winner_ = 2;
         gameOver_ = true;
     }
     else if (player2Tanks == 0)
     {
         writeToOutputLog("Player 1 won with " + std::to_string(player1Tanks) + " tanks still alive");
+        winner_ = 1;
         gameOver_ = true;
     }
 
     if (hasErrors) { errorLog.close(); }
     
     if (gameOver_){
+        flushLogs();
         return;
     }
     
 
-    cout << "Board setup complete:\n";
-    board_.render();
-
-
-    // Fill vertices based on grid
-    for (int row = 0; row < static_cast<int>(height); row++) {
-        for (int col = 0; col < static_cast<int>(width); col++) {
-            std::string cell = board_.getGrid()[row][col];
-            if (cell == "#") {
-                board_.addNewVertexToMap(row, col, true, false);
-            } else if (cell == "@") {
-                board_.addNewVertexToMap(row, col, false, true);
-            } else {
-                board_.addNewVertexToMap(row, col);
-            }
-        }
+    if (consoleOutput_) {
+        cout << "Board setup complete:\n";
+        board_.render();
     }
+    flushLogs();
 }
 
 void GameManager::run() {
+    if (!replayFileName_.empty()) {
+        replay_ = make_unique<ReplayWriter>(replayFileName_, tanksList_.size(), replayKeyframeInterval_);
+    }
+    if (!profile_) { playRounds(); }
+    else {
+        GameProfile::Clock::time_point start = GameProfile::Clock::now();
+        playRounds();
+        profile_->addTotalTime(GameProfile::Clock::now() - start);
+        countSearches();
+    }
+    if (replay_) {
+        /* A game over before its first turn still gets its initial board. */
+        if (replay_->getTurns() == 0 && replay_->keyframeDue()) { replay_->writeKeyframe(cloneState()); }
+        replay_->finish(winner_, rounds_);
+        replay_.reset();
+    }
+}
+
+void GameManager::playRounds() {
     if (gameOver_){
         return;
     }
-    int rounds = 0;
+    rounds_ = 0;
+    stateRepetitions_.clear();
 
     // by the advice given in the forum, we first move all the shells, check for hits,
     // move the tanks, and then check for hits again
-    while ((rounds < maxRounds_ * 2) && (roundsWithoutAmmo_ < 80))
+    while ((rounds_ < maxRounds_ * 2) && (roundsWithoutAmmo_ < 80))
     {
-        cout << "===Round " << rounds << "===" << endl;
-        board_.render();
-        board_.moveAllShells();
-        std::vector<std::pair<size_t, size_t>> newTankPositions = board_.updateObjectsOnBoard();
-        satelliteView_->setPositions(newTankPositions);
-        satelliteView_->updateGrid(board_.getGrid());
+        if (consoleOutput_) {
+            timePhase(GameProfile::LOGGING, [this] {
+                cout << "===Round " << rounds_ << "===" << '\n';
+                board_.render();
+            });
+        }
+        if (replay_ && rounds_ % 2 == 0 && replay_->keyframeDue()) {
+            timePhase(GameProfile::LOGGING, [this] { replay_->writeKeyframe(cloneState()); });
+        }
+        if (profile_) { profile_->countHalfRound(board_.getShells().size()); }
+        timePhase(GameProfile::SHELL_MOVEMENT, [this] { board_.moveAllShells(); });
+        timePhase(GameProfile::COLLISIONS, [this] { board_.updateObjectsOnBoard(); });
+        timePhase(GameProfile::SATELLITE_REFRESH, [this] { syncSatelliteView(); });
         if (gameOver()){
+            timePhase(GameProfile::LOGGING, [this] { flushLogs(); });
             return;
         }
-        if (rounds % 2 == 0){
+        if (rounds_ % 2 == 0){
             int tankInd = 0;
             ammoLeft_ = false;
+            if (decisionPool_) {
+                timePhase(GameProfile::PARALLEL_DECISIONS, [this] { decideActions(); });
+            }
+            if (replay_) { replayActions_.assign(tanksList_.size(), ActionRequest::DoNothing); }
             for (const auto& tank : tanksList_) {
                 if (!board_.isTankAlive(tankInd)){
                     tankInd++;
                     continue;
                 }
                 satelliteView_->setCurrTankInd(tankInd);
-                ActionRequest action = tank->getAction();
+                GameProfile::Phase decisions = (tankPlayerIndices_[tankInd] == 1) ?
+                    GameProfile::PLAYER_1_DECISIONS : GameProfile::PLAYER_2_DECISIONS;
+                ActionRequest action;
+                if (decisionPool_) {
+                    timePhase(GameProfile::LOGGING, [&] { cout << debugOutputs_[tankInd]; });
+                    action = actions_[tankInd];
+                }
+                else { timePhase(decisions, [&] { action = tank->getAction(); }); }
                 bool actionSuccess = true;
                 if (action != ActionRequest::GetBattleInfo){
-                    actionSuccess = board_.act(action, tankInd);
+                    timePhase(GameProfile::TANK_ACTIONS, [&] {
+                        actionSuccess = board_.act(action, tankInd);
+                    });
                 }
                 else{
-                    if (tankPlayerIndices_[tankInd] == 1){
-                        player1_->updateTankWithBattleInfo(*tank, *satelliteView_);
-
+                    if (profile_) { profile_->countBattleInfo(tankPlayerIndices_[tankInd]); }
+                    timePhase(decisions, [&] {
+                        if (tankPlayerIndices_[tankInd] == 1){
+                            player1_->updateTankWithBattleInfo(*tank, *satelliteView_);
+
+                        }
+                        else{
+                            player2_->updateTankWithBattleInfo(*tank, *satelliteView_);
+                        }
+                    });
+                }
+                if (profile_) { profile_->countAction(!actionSuccess); }
+                if (replay_) { replayActions_[tankInd] = action; }
+                timePhase(GameProfile::LOGGING, [&] {
+                    if (actionSuccess) {
+                        writeToOutputLog(actionRequestToString(action));
+                        if (consoleOutput_) { cout << actionRequestToString(action) << '\n'; }
                     }
-                    else{
-                        player2_->updateTankWithBattleInfo(*tank, *satelliteView_);
+                    else { 
+                        writeToOutputLog(actionRequestToString(action) + " (ignored)");
+                        if (consoleOutput_) {
+                            cout << actionRequestToString(action) << "(ignored)" << '\n';
+                        }
                     }
-                }
-                if (actionSuccess) {
-                    writeToOutputLog(actionRequestToString(action));
-                    cout << actionRequestToString(action) << endl;
-                }
-                else { 
-                    writeToOutputLog(actionRequestToString(action) + " (ignored)");
-                    cout << actionRequestToString(action) << "(ignored)" << endl;
-                }
+                });
                 if (board_.tankHasAmmo(tankInd)) { ammoLeft_ = true; }
                 tankInd += 1;
             }
+            if (replay_) {
+                timePhase(GameProfile::LOGGING, [this] { replay_->writeTurn(replayActions_); });
+            }
             
-            std::vector<std::pair<size_t, size_t>> newTankPositions = board_.updateObjectsOnBoard();
-            satelliteView_->setPositions(newTankPositions);
-            satelliteView_->updateGrid(board_.getGrid());
+            timePhase(GameProfile::COLLISIONS, [this] { board_.updateObjectsOnBoard(); });
+            timePhase(GameProfile::SATELLITE_REFRESH, [this] { syncSatelliteView(); });
+        }
+        if (gameOver()) {
+            timePhase(GameProfile::LOGGING, [this] { flushLogs(); });
+            return;
         }
-        if (gameOver()) { return; }
         if (!ammoLeft_) { roundsWithoutAmmo_++; }
-        rounds += 1;
+        bool repeated = false;
+        if (repetitionLimit_ > 0) {
+            timePhase(GameProfile::REPETITION_CHECK, [&] { repeated = checkRepetitions(); });
+        }
+        if (repeated) {
+            timePhase(GameProfile::LOGGING, [this] { flushLogs(); });
+            return;
+        }
+        rounds_ += 1;
+        timePhase(GameProfile::LOGGING, [this] { flushLogs(); });
     }
     
     writeToOutputLog("Tie, reached max steps = " + std::to_string(maxRounds_) + ", player 1 has " + std::to_string(board_.getPlayerATanks()) + " tanks, player 2 has " + std::to_string(board_.getPlayerBTanks()) + " tanks");
+    winner_ = 0;
+    gameOver_ = true;
+    flushLogs();
+}
+
+void GameManager::countSearches() {
+    /* Only the base players and tank algorithms keep count of their searches. The tanks' own searches
+     * and the players' distance fields (a single search from all the enemy tanks at once) are counted
+     * apart. */
+    unsigned long bfs_runs = 0, paths_searched = 0, paths_reused = 0, fields_built = 0, field_lookups = 0;
+    for (const auto& tank : tanksList_) {
+        const BaseTankAlgorithm* base_tank = dynamic_cast<const BaseTankAlgorithm*>(tank.get());
+        if (!base_tank) { continue; }
+        bfs_runs += base_tank->getBfsRuns();
+        paths_searched += base_tank->getPathCacheMisses();
+        paths_reused += base_tank->getPathCacheHits();
+    }
+    for (const Player* player : {player1_.get(), player2_.get()}) {
+        const BasePlayer* base_player = dynamic_cast<const BasePlayer*>(player);
+        if (!base_player) { continue; }
+        fields_built += base_player->getDistanceFieldBuilds();
+        field_lookups += base_player->getDistanceFieldLookups();
+    }
+    profile_->setSearches(bfs_runs, paths_searched, paths_reused, fields_built, field_lookups);
+}
+
+void GameManager::decideActions() {
+    /* A tank's action depends only on its own algorithm's state: the board is not touched until all the
+     * actions are in, and the battle info they asked for is only handed out afterwards, in order. Their
+     * debug printing is collected per tank, to be printed when their actions are. */
+    actions_.resize(tanksList_.size());
+    debugOutputs_.resize(tanksList_.size());
+    decisionPool_->parallelFor(tanksList_.size(), [this](size_t tankInd) {
+        debugOutputs_[tankInd].clear();
+        if (!board_.isTankAlive(tankInd)) { return; }
+        if (!BaseTankAlgorithm::getDebugOutput()) {
+            actions_[tankInd] = tanksList_[tankInd]->getAction();
+            return;
+        }
+        ostringstream debug;
+        BaseTankAlgorithm::setDebugStream(debug);
+        try {
+            actions_[tankInd] = tanksList_[tankInd]->getAction();
+        } catch (...) {
+            BaseTankAlgorithm::setDebugStream(cout);
+            throw;
+        }
+        BaseTankAlgorithm::setDebugStream(cout);
+        debugOutputs_[tankInd] = debug.str();
+    });
+}
+
+bool GameManager::checkRepetitions() {
+    if (repetitionLimit_ <= 0) { return false; }
+    /* Tanks only act on even rounds, so a state means something else after an odd one. */
+    uint64_t state = board_.hashState() ^ (rounds_ % 2 == 0 ? 0 : Zobrist::ROUND_SALT);
+    if (++stateRepetitions_[state] < repetitionLimit_) { return false; }
+    writeToOutputLog("Tie, the same state repeated " + std::to_string(repetitionLimit_) + " times, player 1 has " +
+        std::to_string(board_.getPlayerATanks()) + " tanks, player 2 has " +
+        std::to_string(board_.getPlayerBTanks()) + " tanks");
+    winner_ = 0;
+    gameOver_ = true;
+    return true;
+}
+
+void GameManager::syncSatelliteView() {
+    satelliteView_->updateCells(board_.getCells(), board_.getDirtyCells());
+    board_.clearDirtyCells();
+    /* The positions are indexed like the tanks themselves, dead ones included, so that the current
+     * tank's index (see BaseSatelliteView::setCurrTankInd()) keeps pointing at its own position. */
+    for (size_t tankInd = 0; tankInd < tanksList_.size(); ++tankInd) {
+        pair<int, int> pos = board_.getPosTank(tankInd);
+        satelliteView_->setPosition(tankInd, pos.first, pos.second);
+    }
 }
 
 bool GameManager::gameOver() {
     if (board_.getPlayerATanks() == 0 && board_.getPlayerBTanks() == 0) {
         writeToOutputLog("Tie, both players have zero tanks");
+        winner_ = 0;
         gameOver_ = true;
     }
     else if(board_.getPlayerATanks() == 0){
         writeToOutputLog("Player 2 won with " + std::to_string(board_.getPlayerBTanks()) +" tanks still alive");
+        winner_ = 2;
         gameOver_ = true;
     }
     else if (board_.getPlayerBTanks() == 0)
     {
         writeToOutputLog("Player 1 won with " + std::to_string(board_.getPlayerATanks()) +" tanks still alive");
+        winner_ = 1;
         gameOver_ = true;
     }
 
@@ -303,50 +506,36 @@ bool GameManager::gameOver() {
 }
 
 void GameManager::writeToErrorLog(const string& message) {
-    const string input_errors_file = "input_errors.txt";
- 
-     ofstream errorLog(input_errors_file, ios::app);
- 
-     if (errorLog.is_open()) {
-         errorLog << message << '\n';
-         errorLog.close();
-     }
+    if (!errorLog_.is_open()) { errorLog_.open(errorFileName_, ios::app); }
+
+    if (errorLog_.is_open()) {
+        errorLog_ << message << '\n';
+        errorLog_.flush();
+    }
 }
 
 void GameManager::writeToOutputLog(const string& message) {
-    ofstream outputLog(outputFileName_, ios::app);
+    if (!outputLog_.is_open()) { outputLog_.open(outputFileName_, ios::app); }
 
-    if (outputLog.is_open()) {
-        outputLog << message << '\n';
-        outputLog.close();
+    if (outputLog_.is_open()) {
+        outputLog_ << message << '\n';
     }
 }
 
+void GameManager::flushLogs() {
+    if (outputLog_.is_open()) { outputLog_.flush(); }
+    if (consoleOutput_) { cout.flush(); }
+}
+
 void GameManager::resetGameManager() {
+    outputLog_.close();
+    stateRepetitions_.clear();
+    errorLog_.close();
     board_.resetBoard();
     outputFileName_.clear();
     string().swap(outputFileName_);
 }
 
-// taken from chatGPT
-vector<string> GameManager::readInputFile(const string& filename) {
-    ifstream infile(filename);
-    vector<string> lines;
-
-    if (!infile.is_open()) {
-        throw runtime_error("Failed to open input file: " + filename);
-    }
-
-    string line;
-    while (getline(infile, line)) {
-        if (!line.empty()) {
-            lines.push_back(line);
-        }
-    }
-
-    return lines;
-}
-
 string GameManager::getOutputFilename(const string& inputFilename) {
     fs::path inputPath(inputFilename);
     string name = inputPath.filename().string();
@@ -5,13 +5,19 @@
  */
 
 #pragma once
+#include <fstream>
+#include <unordered_map>
 #include "board.h"
+#include "game_state.h"
 #include "TankAlgorithmFactory.h"
 #include "PlayerFactory.h"
 #include "Player.h"
 #include "TankAlgorithm.h"
 #include "ActionRequest.h"
 #include "BaseSatelliteView.h"
+#include "thread_pool.h"
+#include "game_profile.h"
+#include "replay_file.h"
 
 class GameManager {
     private:
@@ -23,11 +29,64 @@ class GameManager {
         std::unique_ptr<Player> player2_;
         std::vector<std::unique_ptr<TankAlgorithm>> tanksList_;
         bool gameOver_;
+        int winner_;
+        int rounds_;
         int maxRounds_;
         std::unique_ptr<BaseSatelliteView> satelliteView_;
         std::vector<int> tankPlayerIndices_;
         bool ammoLeft_;
         int roundsWithoutAmmo_;
+        /* Both logs are opened on their first message and kept open, and the output log is only flushed
+         * at round boundaries and at the end of the game (see flushLogs()). */
+        std::ofstream outputLog_;
+        std::ofstream errorLog_;
+        std::string errorFileName_;
+        bool consoleOutput_;
+        /* Only set when the tanks decide in parallel (see setDecisionThreads()), in which case each
+         * round's actions, and whatever the tanks printed while deciding them, are kept here per tank. */
+        std::unique_ptr<ThreadPool> decisionPool_;
+        std::vector<ActionRequest> actions_;
+        std::vector<std::string> debugOutputs_;
+        /* Only set when the shells are updated in parallel (see setUpdateThreads()), and lent to the
+         * board, which does not own it. */
+        std::unique_ptr<ThreadPool> updatePool_;
+        /* How many times each state of the board (see Board::hashState()) has been seen at the end of a
+         * round, kept only if a repetition limit is set (see setRepetitionLimit()). */
+        int repetitionLimit_;
+        std::unordered_map<std::uint64_t, int> stateRepetitions_;
+        /* Only set when the game is profiled (see setProfiling()). */
+        std::unique_ptr<GameProfile> profile_;
+        /* The replay file the game is recorded into, if any (see setReplayFile()), which is only open
+         * while run() plays, along with the actions of the current turn. */
+        std::string replayFileName_;
+        int replayKeyframeInterval_;
+        std::unique_ptr<ReplayWriter> replay_;
+        std::vector<ActionRequest> replayActions_;
+
+        /** Runs the given part of a round, adding its wall time to the given phase of the profile if the
+         * game is profiled. Otherwise it costs a single check. */
+        template <typename Function>
+        void timePhase(GameProfile::Phase phase, Function&& function) {
+            if (!profile_) {
+                function();
+                return;
+            }
+            GameProfile::Clock::time_point start = GameProfile::Clock::now();
+            function();
+            profile_->addTime(phase, GameProfile::Clock::now() - start);
+        }
+        /** Plays the game's rounds until it is over (see run()). */
+        void playRounds();
+        /** Adds up the searches run by the players and their tanks into the profile. */
+        void countSearches();
+        /** Asks every alive tank for its action on the decision pool, filling actions_ and debugOutputs_. */
+        void decideActions();
+        /** Counts the board's current state, and ends the game in a tie once it has been seen as many
+         * times as the repetition limit allows. Returns whether the game is over. */
+        bool checkRepetitions();
+        /** Passes the board's changes since the last call on to the satellite view: only the cells
+         * the board lists as dirty are re-read, and only the tanks that moved are repositioned. */
+        void syncSatelliteView();
 
     public:
         /* -------------------------------------- CONSTRUCTORS: -------------------------------------- */
@@ -48,11 +107,22 @@ class GameManager {
         /* ----------------------------------------- GETTERS: ---------------------------------------- */
 
         /** Gets the board itself. */
-        Board getBoard() const;
+        const Board& getBoard() const;
 
         /** Gets the output file's name. */
         std::string getOutputFileName() const;
 
+        /** Gets the index of the player who won the game, 0 if it ended in a tie, or -1 if it is not over
+         * yet. */
+        int getWinner() const;
+
+        /** Gets a copy of the game's simulation state (see GameState), without its logs, factories,
+         * players or tank algorithms. */
+        GameState cloneState() const;
+
+        /** Gets the profile of the game (see setProfiling()), or nullptr if it is not profiled. */
+        const GameProfile* getProfile() const;
+
         /* ----------------------------------------- SETTERS: ---------------------------------------- */
 
         /** Sets the board itself to the given one. */
@@ -61,6 +131,44 @@ class GameManager {
         /** Sets the output file's name to the given one. */
         void setOutputFileName(std::string output_file_name);
 
+        /** Sets the name of the file the input's errors are written into (input_errors.txt by default).
+         * Games loaded side by side in the same directory each need their own. */
+        void setErrorFileName(std::string error_file_name);
+
+        /** Sets whether the game is rendered and narrated on the console (it is by default), including
+         * the board's position reports. The output file is written either way. */
+        void setConsoleOutput(bool console_output);
+
+        /** Sets the number of threads on which the tanks decide their actions every round (1, the
+         * default, asks them one by one). The actions are still applied, and everything is still
+         * printed, in the tanks' order, so the game plays out exactly as it does serially. No more
+         * threads than the machine's hardware threads are used. */
+        void setDecisionThreads(int threads);
+
+        /** Sets the number of threads on which the board moves its shells and resolves their collisions
+         * every half-round (1, the default, updates them serially). Only boards with thousands of shells
+         * in flight are worth splitting between threads, so they are only split while at least the given
+         * number of shells are in flight, and the result is exactly the serial one (see
+         * Board::setThreadPool()). No more threads than the machine's hardware threads are used. */
+        void setUpdateThreads(int threads,
+            std::size_t min_parallel_shells = Board::DEFAULT_MIN_PARALLEL_SHELLS);
+
+        /** Sets the number of times the same state of the board (tanks and shells included) may be seen
+         * at the end of a round before the game ends in a tie, or 0 (the default) for no limit. Tanks
+         * caught in a loop then stop burning the rest of the step budget. */
+        void setRepetitionLimit(int repetition_limit);
+
+        /** Sets whether the game is profiled (it is not by default): if so, run() times every phase of
+         * every round and counts the shells, actions and searches it goes through, into a profile that is
+         * kept once the game is over (see getProfile()). Otherwise the phases are run untimed, so the
+         * game is as fast as it is without profiling. */
+        void setProfiling(bool profiling);
+
+        /** Sets the file run() records the game into as a replay (see ReplayWriter), with a keyframe of
+         * the whole board every given number of turns, or an empty name (the default) for no replay. The
+         * tanks' actions take 4 bits each per turn, so only the keyframes grow with the board's size. */
+        void setReplayFile(std::string replay_file_name, int keyframe_interval = 64);
+
         /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
 
         /** Sets up the board from the input lines. */
@@ -73,10 +181,11 @@ class GameManager {
         void writeToErrorLog(const std::string& message);
         /** Writes the given message to the output log. */
         void writeToOutputLog(const std::string& message);
+        /** Flushes everything written to the logs and the console so far. */
+        void flushLogs();
         /** Resets the GameManaer-type object. */
         void resetGameManager();
         /** utils */
-        vector<string> readInputFile(const string& filename);
-        string getOutputFilename(const string& inputFilename);
+        static string getOutputFilename(const string& inputFilename);
         string actionRequestToString(ActionRequest action);
 };
\ No newline at end of file
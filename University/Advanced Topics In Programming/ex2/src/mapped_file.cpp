@@ -0,0 +1,68 @@
+/**
+ * @file mapped_file.cpp
+ * @brief A file detailing the implementation of all the functions declared in mapped_file.h.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#include "mapped_file.h"
+#include <fcntl.h>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+/* ------------------------------------------ CONSTRUCTORS: ------------------------------------------ */
+
+MappedFile::MappedFile(const string& file_name) : data_(nullptr), size_(0), mapped_(false) {
+    int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd != -1) {
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) == 0 && S_ISREG(file_stat.st_mode) && file_stat.st_size > 0) {
+            void* data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                data_ = static_cast<const char*>(data);
+                size_ = file_stat.st_size;
+                mapped_ = true;
+            }
+        }
+        close(fd);
+    }
+    if (mapped_) { return; }
+
+    /* Empty files, pipes and the like cannot be mapped, so they are read the usual way. */
+    ifstream infile(file_name, ios::binary);
+    if (!infile.is_open()) {
+        throw runtime_error("Failed to open input file: " + file_name);
+    }
+    contents_.assign(istreambuf_iterator<char>(infile), istreambuf_iterator<char>());
+    data_ = contents_.data();
+    size_ = contents_.size();
+}
+
+MappedFile::~MappedFile() {
+    if (mapped_) { munmap(const_cast<char*>(data_), size_); }
+}
+
+/* --------------------------------------------- GETTERS: -------------------------------------------- */
+
+string_view MappedFile::getContents() const {
+    return string_view(data_, size_);
+}
+
+/* ----------------------------------------- OTHER FUNCTIONS: ---------------------------------------- */
+
+bool MappedFile::nextLine(string_view& contents, string_view& line) {
+    while (!contents.empty()) {
+        size_t end = contents.find('\n');
+        string_view candidate = contents.substr(0, end);
+        contents.remove_prefix(end == string_view::npos ? contents.size() : end + 1);
+        if (!candidate.empty()) {
+            line = candidate;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,45 @@
+/**
+ * @file mapped_file.h
+ * @brief A file depicting the MappedFile class declaration.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#pragma once
+#include <string>
+#include <string_view>
+
+/** A read-only view of a whole file's contents. The file is memory-mapped where possible, so it can be
+ * parsed in place without first being copied into lines, and is read into memory otherwise. */
+class MappedFile {
+    private:
+        const char* data_;
+        size_t size_;
+        bool mapped_;
+        std::string contents_;
+
+    public:
+        /* -------------------------------------- CONSTRUCTORS: -------------------------------------- */
+
+        /** Maps the file with the given name. Throws a runtime_error if it cannot be opened. */
+        explicit MappedFile(const std::string& file_name);
+        /** Deleted Copy Constructor, as the mapping can only be released once. */
+        MappedFile(const MappedFile& mapped_file) = delete;
+        /** Unmaps the file. */
+        ~MappedFile();
+
+        /* ---------------------------------------- OPERATORS: --------------------------------------- */
+
+        /** Deleted Assignment Operator, as the mapping can only be released once. */
+        MappedFile& operator=(const MappedFile& mapped_file) = delete;
+
+        /* ----------------------------------------- GETTERS: ---------------------------------------- */
+
+        /** Gets the file's contents, which remain valid for as long as this object exists. */
+        std::string_view getContents() const;
+
+        /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
+
+        /** Takes the next non-empty line (without its '\n') off the front of the given contents, and
+         * stores it in the given line. Returns false, leaving the line untouched, if none is left. */
+        static bool nextLine(std::string_view& contents, std::string_view& line);
+};
@@ -0,0 +1,57 @@
+/**
+ * @file neighbor_table.cpp
+ * @brief A file detailing the implementation of all the functions declared in neighbor_table.h.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#include "neighbor_table.h"
+#include <map>
+#include <mutex>
+using namespace std;
+
+/* ------------------------------------------ CONSTRUCTORS: ------------------------------------------ */
+
+NeighborTable::NeighborTable() {
+    rows_ = 0;
+    columns_ = 0;
+    neighbors_ = vector<int>();
+}
+
+NeighborTable::NeighborTable(int rows, int columns) {
+    rows_ = rows;
+    columns_ = columns;
+    neighbors_.resize(static_cast<size_t>(rows_) * columns_ * 8);
+    int* neighbor = neighbors_.data();
+    for (int row = 0; row < rows_; row++) {
+        for (int col = 0; col < columns_; col++) {
+            for (Direction dir : DIRECTIONS) {
+                pair<int, int> pos = getNextCoordsInDir(dir, {row, col}, rows_, columns_);
+                *neighbor++ = pos.first * columns_ + pos.second;
+            }
+        }
+    }
+}
+
+/* --------------------------------------------- GETTERS: -------------------------------------------- */
+
+int NeighborTable::getRows() const {
+    return rows_;
+}
+
+int NeighborTable::getColumns() const {
+    return columns_;
+}
+
+shared_ptr<const NeighborTable> NeighborTable::getShared(int rows, int columns) {
+    /* The games of a tournament run on threads of their own, so the tables they share are guarded. */
+    static mutex tables_mutex;
+    static map<pair<int, int>, weak_ptr<const NeighborTable>> tables;
+    lock_guard<mutex> lock(tables_mutex);
+    weak_ptr<const NeighborTable>& cached = tables[{rows, columns}];
+    shared_ptr<const NeighborTable> table = cached.lock();
+    if (!table) {
+        table = make_shared<const NeighborTable>(rows, columns);
+        cached = table;
+    }
+    return table;
+}
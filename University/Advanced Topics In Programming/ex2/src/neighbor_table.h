@@ -0,0 +1,44 @@
+/**
+ * @file neighbor_table.h
+ * @brief A file depicting the NeighborTable class declaration.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#pragma once
+#include <memory>
+#include <vector>
+#include "direction.h"
+
+/** The row-major index of every cell's neighbor in each of the 8 directions on a toroidal board of given
+ * dimensions, so that the searches expanding cells by the million (see BFS and DistanceField) step with a
+ * single load instead of converting indices to coordinates and wrapping them around. At 32 bytes per cell
+ * it is too large to keep one per search: every search on a board shares the one from getShared(). */
+class NeighborTable {
+    private:
+        int rows_;
+        int columns_;
+        /* The neighbors of the cell at index i are at [8 * i, 8 * i + 8), in direction index order. */
+        std::vector<int> neighbors_;
+
+    public:
+        /* -------------------------------------- CONSTRUCTORS: -------------------------------------- */
+
+        /** Default Constructor. */
+        NeighborTable();
+        /** Builds the table of a board of the given dimensions. */
+        NeighborTable(int rows, int columns);
+
+        /* ----------------------------------------- GETTERS: ---------------------------------------- */
+
+        /** Gets the number of rows in the table. */
+        int getRows() const;
+        /** Gets the number of columns in the table. */
+        int getColumns() const;
+        /** Gets the index of the given cell's neighbor in the direction of the given index. */
+        int getNeighbor(int index, int dir_idx) const { return neighbors_[8 * index + dir_idx]; }
+        /** Gets the indices of all 8 of the given cell's neighbors, in direction index order. */
+        const int* getNeighbors(int index) const { return neighbors_.data() + 8 * index; }
+        /** Gets the table of a board of the given dimensions, shared by everyone holding it: it is only
+         * built if no one holds one of those dimensions yet, and freed once the last holder lets go. */
+        static std::shared_ptr<const NeighborTable> getShared(int rows, int columns);
+};
@@ -0,0 +1,249 @@
+/**
+ * @file replay_file.cpp
+ * @brief A file detailing the implementation of all the functions declared in replay_file.h.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#include "replay_file.h"
+#include "binary_io.h"
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+using namespace std;
+
+namespace {
+    const string HEADER_MAGIC = "TKRP";
+    const string FOOTER_MAGIC = "TKRI";
+    constexpr uint8_t VERSION = 1;
+    constexpr char KEYFRAME_TAG = 'K';
+    constexpr char TURN_TAG = 'T';
+    constexpr char INDEX_TAG = 'I';
+    constexpr int FOOTER_SIZE = 12;
+
+    /** Reads the given number of bytes as a string, or fewer if the stream ends. */
+    string readString(istream& in, size_t size) {
+        string text(size, '\0');
+        in.read(text.data(), size);
+        text.resize(in.gcount());
+        return text;
+    }
+}
+
+/* ------------------------------------------ CONSTRUCTORS: ------------------------------------------ */
+
+ReplayWriter::ReplayWriter(const string& file_name, int tanks, int keyframe_interval) {
+    out_.open(file_name, ios::binary | ios::trunc);
+    if (!out_.is_open()) { throw runtime_error("Failed to open replay file: " + file_name); }
+    tanks_ = tanks;
+    keyframeInterval_ = max(1, keyframe_interval);
+    turns_ = 0;
+    out_ << HEADER_MAGIC;
+    BinaryIO::writeUint8(out_, VERSION);
+    BinaryIO::writeUint32(out_, tanks_);
+    BinaryIO::writeUint32(out_, keyframeInterval_);
+}
+
+ReplayReader::ReplayReader(const string& file_name) {
+    in_.open(file_name, ios::binary);
+    if (!in_.is_open()) { throw runtime_error("Failed to open replay file: " + file_name); }
+    in_.seekg(0, ios::end);
+    fileSize_ = in_.tellg();
+    in_.seekg(0);
+    if (readString(in_, HEADER_MAGIC.size()) != HEADER_MAGIC || BinaryIO::readUint8(in_) != VERSION) {
+        throw runtime_error("Not a replay file: " + file_name);
+    }
+    tanks_ = BinaryIO::readUint32(in_);
+    keyframeInterval_ = BinaryIO::readUint32(in_);
+    uint64_t records = in_.tellg();
+
+    /* The index is found through the footer, if the game got to write one. */
+    if (fileSize_ >= records + FOOTER_SIZE) {
+        in_.seekg(fileSize_ - FOOTER_SIZE);
+        uint64_t index = BinaryIO::readUint64(in_);
+        bool footer = readString(in_, FOOTER_MAGIC.size()) == FOOTER_MAGIC;
+        if (footer && index >= records && index < fileSize_) {
+            in_.seekg(index);
+            if (in_.get() != INDEX_TAG) { throw runtime_error("Corrupt replay file: " + file_name); }
+            turns_ = BinaryIO::readUint32(in_);
+            winner_ = BinaryIO::readInt32(in_);
+            rounds_ = BinaryIO::readInt32(in_);
+            size_t keyframes = BinaryIO::readUint32(in_);
+            for (size_t i = 0; i < keyframes; ++i) {
+                int turn = BinaryIO::readUint32(in_);
+                keyframes_.emplace_back(turn, BinaryIO::readUint64(in_));
+            }
+            return;
+        }
+    }
+    scanRecords(records);
+}
+
+/* --------------------------------------------- GETTERS: -------------------------------------------- */
+
+int ReplayWriter::getTurns() const {
+    return turns_;
+}
+
+bool ReplayWriter::keyframeDue() const {
+    return turns_ % keyframeInterval_ == 0 && (keyframes_.empty() || keyframes_.back().first != turns_);
+}
+
+int ReplayReader::getTanks() const {
+    return tanks_;
+}
+
+int ReplayReader::getTurns() const {
+    return turns_;
+}
+
+int ReplayReader::getKeyframeInterval() const {
+    return keyframeInterval_;
+}
+
+vector<int> ReplayReader::getKeyframeTurns() const {
+    vector<int> turns;
+    for (const auto& keyframe : keyframes_) { turns.push_back(keyframe.first); }
+    return turns;
+}
+
+int ReplayReader::getWinner() const {
+    return winner_;
+}
+
+int ReplayReader::getRounds() const {
+    return rounds_;
+}
+
+/* ----------------------------------------- OTHER FUNCTIONS: ---------------------------------------- */
+
+void ReplayWriter::writeKeyframe(const GameState& state) {
+    ostringstream buffer;
+    state.writeState(buffer);
+    string bytes = buffer.str();
+    keyframes_.emplace_back(turns_, static_cast<uint64_t>(out_.tellp()));
+    out_.put(KEYFRAME_TAG);
+    BinaryIO::writeUint32(out_, turns_);
+    BinaryIO::writeUint32(out_, bytes.size());
+    out_.write(bytes.data(), bytes.size());
+}
+
+void ReplayWriter::writeTurn(const vector<ActionRequest>& actions) {
+    auto nibble = [&actions](int tankInd) {
+        size_t ind = tankInd;
+        ActionRequest action = (ind < actions.size()) ? actions[ind] : ActionRequest::DoNothing;
+        return static_cast<uint8_t>(action);
+    };
+    out_.put(TURN_TAG);
+    for (int tankInd = 0; tankInd < tanks_; tankInd += 2) {
+        out_.put(static_cast<char>(nibble(tankInd) | (nibble(tankInd + 1) << 4)));
+    }
+    turns_++;
+}
+
+void ReplayWriter::finish(int winner, int rounds) {
+    uint64_t index = out_.tellp();
+    out_.put(INDEX_TAG);
+    BinaryIO::writeUint32(out_, turns_);
+    BinaryIO::writeInt32(out_, winner);
+    BinaryIO::writeInt32(out_, rounds);
+    BinaryIO::writeUint32(out_, keyframes_.size());
+    for (const auto& keyframe : keyframes_) {
+        BinaryIO::writeUint32(out_, keyframe.first);
+        BinaryIO::writeUint64(out_, keyframe.second);
+    }
+    BinaryIO::writeUint64(out_, index);
+    out_ << FOOTER_MAGIC;
+    out_.close();
+    if (out_.fail()) { throw runtime_error("Failed to write replay file"); }
+}
+
+void ReplayReader::scanRecords(uint64_t start) {
+    /* Only the records written in full count: the last one may have been cut short. */
+    turns_ = 0;
+    winner_ = -1;
+    rounds_ = -1;
+    in_.clear();
+    in_.seekg(start);
+    while (static_cast<uint64_t>(in_.tellg()) < fileSize_) {
+        uint64_t offset = in_.tellg();
+        char tag;
+        try {
+            tag = skipRecord();
+        } catch (const runtime_error&) {
+            break;
+        }
+        if (tag == KEYFRAME_TAG) { keyframes_.emplace_back(turns_, offset); }
+        else if (tag == TURN_TAG) { turns_++; }
+        else { break; }
+    }
+    /* A keyframe is only written right before its turn's actions, so a last one without them adds
+     * nothing. */
+    if (!keyframes_.empty() && keyframes_.back().first > turns_) { keyframes_.pop_back(); }
+    if (keyframes_.empty()) { throw runtime_error("Replay file has no keyframes"); }
+}
+
+char ReplayReader::skipRecord() {
+    char tag = static_cast<char>(BinaryIO::readUint8(in_));
+    uint64_t size = 0;
+    if (tag == KEYFRAME_TAG) {
+        BinaryIO::readUint32(in_);
+        size = BinaryIO::readUint32(in_);
+    } else if (tag == TURN_TAG) {
+        size = (tanks_ + 1) / 2;
+    }
+    if (static_cast<uint64_t>(in_.tellg()) + size > fileSize_) {
+        throw runtime_error("Unexpected end of binary file");
+    }
+    in_.seekg(size, ios::cur);
+    return tag;
+}
+
+vector<ActionRequest> ReplayReader::readTurn() {
+    if (in_.get() != TURN_TAG) { throw runtime_error("Corrupt replay file: expected a turn"); }
+    vector<ActionRequest> actions(tanks_);
+    for (int tankInd = 0; tankInd < tanks_; tankInd += 2) {
+        uint8_t byte = BinaryIO::readUint8(in_);
+        for (int half = 0; half < 2 && tankInd + half < tanks_; ++half) {
+            int action = (byte >> (4 * half)) & 0xF;
+            if (action > static_cast<int>(ActionRequest::DoNothing)) {
+                throw runtime_error("Corrupt replay file: unknown action");
+            }
+            actions[tankInd + half] = static_cast<ActionRequest>(action);
+        }
+    }
+    return actions;
+}
+
+GameState ReplayReader::readKeyframe(size_t keyframe) {
+    in_.clear();
+    in_.seekg(keyframes_.at(keyframe).second);
+    if (in_.get() != KEYFRAME_TAG) { throw runtime_error("Corrupt replay file: expected a keyframe"); }
+    BinaryIO::readUint32(in_);
+    BinaryIO::readUint32(in_);
+    return GameState::readState(in_);
+}
+
+vector<vector<ActionRequest>> ReplayReader::readTurns(size_t keyframe) {
+    int first = keyframes_.at(keyframe).first;
+    int last = (keyframe + 1 < keyframes_.size()) ? keyframes_[keyframe + 1].first : turns_;
+    in_.clear();
+    in_.seekg(keyframes_[keyframe].second);
+    skipRecord();
+    vector<vector<ActionRequest>> turns;
+    for (int turn = first; turn < last; ++turn) { turns.push_back(readTurn()); }
+    return turns;
+}
+
+GameState ReplayReader::getState(int turn) {
+    if (turn < 0 || turn > turns_) {
+        throw out_of_range("Turn " + to_string(turn) + " is not in the replay (0 to " +
+            to_string(turns_) + ")");
+    }
+    /* The last keyframe at or before the turn. */
+    size_t keyframe = upper_bound(keyframes_.begin(), keyframes_.end(), make_pair(turn, UINT64_MAX)) -
+        keyframes_.begin() - 1;
+    GameState state = readKeyframe(keyframe);
+    vector<vector<ActionRequest>> turns = readTurns(keyframe);
+    for (int i = 0; i < turn - keyframes_[keyframe].first; ++i) { state.step(turns[i]); }
+    return state;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file replay_file.h
+ * @brief A file depicting the ReplayWriter and ReplayReader class declarations.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "game_state.h"
+#include "ActionRequest.h"
+
+/** Records a game into a replay file, in a few bits per tank per turn, so that any turn of it can be
+ * looked at again without running the tank algorithms. The file's layout, with all integers little-endian
+ * (see BinaryIO), is:
+ *   header:    "TKRP", version (1 byte), number of tanks (4), keyframe interval (4)
+ *   keyframe:  'K', turn (4), size in bytes (4), the game's state at the start of that turn (see
+ *              GameState::writeState())
+ *   turn:      'T', every tank's action in 4 bits (the even tanks' in the low ones)
+ *   index:     'I', turns (4), winner (4), rounds (4), keyframes (4), and every keyframe's turn (4) and
+ *              offset (8)
+ *   footer:    the index's offset (8), "TKRI"
+ * A turn is a tank round and the shells' round after it, as GameState::step() plays them. The first
+ * keyframe is of turn 0, the game's initial board, and another one is written every keyframe interval
+ * turns, right before that turn's actions. The index and the footer are only written once the game is
+ * over. */
+class ReplayWriter {
+    private:
+        std::ofstream out_;
+        int tanks_;
+        int keyframeInterval_;
+        int turns_;
+        std::vector<std::pair<int, std::uint64_t>> keyframes_;    /* Every keyframe's turn and offset. */
+
+    public:
+        /* -------------------------------------- CONSTRUCTORS: -------------------------------------- */
+
+        /** Creates a replay file with the given name for a game of the given number of tanks, writing its
+         * header. Throws a runtime_error if the file cannot be opened. */
+        ReplayWriter(const std::string& file_name, int tanks, int keyframe_interval);
+
+        /* ----------------------------------------- GETTERS: ---------------------------------------- */
+
+        /** Gets the number of turns written so far. */
+        int getTurns() const;
+        /** Checks whether a keyframe is due before the next turn's actions (see writeKeyframe()). */
+        bool keyframeDue() const;
+
+        /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
+
+        /** Writes the given state as the keyframe of the next turn. */
+        void writeKeyframe(const GameState& state);
+        /** Writes the actions of the next turn, the i-th of which is the i-th tank's. */
+        void writeTurn(const std::vector<ActionRequest>& actions);
+        /** Writes the index and the footer, given how the game ended: its winner (see
+         * GameManager::getWinner()) and its number of rounds, and closes the file. */
+        void finish(int winner, int rounds);
+};
+
+/** Reads a replay file written by ReplayWriter, and rebuilds the game's state at any turn from the last
+ * keyframe before it. A file without an index (of a game that never ended) is indexed by reading it
+ * through instead. */
+class ReplayReader {
+    private:
+        std::ifstream in_;
+        std::uint64_t fileSize_;
+        int tanks_;
+        int keyframeInterval_;
+        int turns_;
+        int winner_;
+        int rounds_;
+        std::vector<std::pair<int, std::uint64_t>> keyframes_;    /* Every keyframe's turn and offset. */
+
+        /** Builds the index of a file without one, by reading through all of its records. */
+        void scanRecords(std::uint64_t start);
+        /** Reads the record at the current position, returning its tag. A keyframe's state is skipped. */
+        char skipRecord();
+        /** Reads the actions of the turn record at the current position. */
+        std::vector<ActionRequest> readTurn();
+
+    public:
+        /* -------------------------------------- CONSTRUCTORS: -------------------------------------- */
+
+        /** Opens the replay file with the given name, and reads its header and its index. Throws a
+         * runtime_error if it cannot be opened or is not a replay file. */
+        explicit ReplayReader(const std::string& file_name);
+
+        /* ----------------------------------------- GETTERS: ---------------------------------------- */
+
+        /** Gets the number of tanks the game was played with. */
+        int getTanks() const;
+        /** Gets the number of turns recorded. */
+        int getTurns() const;
+        /** Gets the number of turns between keyframes. */
+        int getKeyframeInterval() const;
+        /** Gets the turn of every keyframe, in order. */
+        std::vector<int> getKeyframeTurns() const;
+        /** Gets the winner of the game as GameManager::getWinner() does, or -1 if the replay has no index
+         * because the game never ended. */
+        int getWinner() const;
+        /** Gets the number of rounds the game lasted (counting the shells' half-rounds as
+         * GameManager::run() does), or -1 if the replay has no index. */
+        int getRounds() const;
+
+        /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
+
+        /** Reads the state stored in the given keyframe (indexed as in getKeyframeTurns()). */
+        GameState readKeyframe(std::size_t keyframe);
+        /** Reads the actions of every turn from the given keyframe up to the next one, or up to the last
+         * recorded turn. */
+        std::vector<std::vector<ActionRequest>> readTurns(std::size_t keyframe);
+        /** Gets the state of the game at the start of the given turn (0 to getTurns()), by reading the
+         * last keyframe before it and playing its turns forward from there. */
+        GameState getState(int turn);
+};
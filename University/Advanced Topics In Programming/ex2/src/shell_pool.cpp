@@ -0,0 +1,109 @@
+/**
+ * @file shell_pool.cpp
+ * @brief A file detailing the implementation of all the functions declared in shell_pool.h.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#include "shell_pool.h"
+using namespace std;
+
+/* -------------------------------------------- OPERATORS: ------------------------------------------- */
+
+bool ShellPool::operator==(const ShellPool& shell_pool) const {
+    return (positions_ == shell_pool.positions_ && directions_ == shell_pool.directions_ &&
+            states_ == shell_pool.states_);
+}
+
+bool ShellPool::operator!=(const ShellPool& shell_pool) const {
+    return !(*this == shell_pool);
+}
+
+/* --------------------------------------------- GETTERS: -------------------------------------------- */
+
+size_t ShellPool::size() const {
+    return positions_.size();
+}
+
+bool ShellPool::empty() const {
+    return positions_.empty();
+}
+
+pair<int, int> ShellPool::getPos(size_t i) const {
+    return positions_[i];
+}
+
+Direction ShellPool::getDir(size_t i) const {
+    return directions_[i];
+}
+
+bool ShellPool::hasExploded(size_t i) const {
+    return states_[i] & EXPLODED;
+}
+
+bool ShellPool::isFresh(size_t i) const {
+    return states_[i] & FRESH;
+}
+
+/* --------------------------------------------- SETTERS: -------------------------------------------- */
+
+void ShellPool::setExploded(size_t i, bool exploded) {
+    if (exploded) { states_[i] |= EXPLODED; }
+    else { states_[i] &= ~EXPLODED; }
+}
+
+void ShellPool::setFresh(size_t i, bool fresh) {
+    if (fresh) { states_[i] |= FRESH; }
+    else { states_[i] &= ~FRESH; }
+}
+
+/* ----------------------------------------- OTHER FUNCTIONS: ---------------------------------------- */
+
+void ShellPool::addShell(pair<int, int> pos, Direction dir) {
+    positions_.push_back(pos);
+    directions_.push_back(dir);
+    states_.push_back(FRESH);
+}
+
+pair<int, int> ShellPool::moveShell(size_t i, int rows, int columns) {
+    if (states_[i] & FRESH) {
+        states_[i] &= ~FRESH;
+    } else {
+        positions_[i] = getNextCoordsInDir(directions_[i], positions_[i], rows, columns);
+    }
+    return positions_[i];
+}
+
+void ShellPool::swapAndPop(size_t i) {
+    positions_[i] = positions_.back();
+    directions_[i] = directions_.back();
+    states_[i] = states_.back();
+    positions_.pop_back();
+    directions_.pop_back();
+    states_.pop_back();
+}
+
+void ShellPool::removeExploded() {
+    size_t kept = 0;
+    for (size_t i = 0; i < positions_.size(); ++i) {
+        if (states_[i] & EXPLODED) { continue; }
+        positions_[kept] = positions_[i];
+        directions_[kept] = directions_[i];
+        states_[kept] = states_[i];
+        kept++;
+    }
+    positions_.resize(kept);
+    directions_.resize(kept);
+    states_.resize(kept);
+}
+
+void ShellPool::clear() {
+    positions_.clear();
+    directions_.clear();
+    states_.clear();
+}
+
+void ShellPool::resetShellPool() noexcept {
+    vector<pair<int, int>>().swap(positions_);
+    vector<Direction>().swap(directions_);
+    vector<uint8_t>().swap(states_);
+}
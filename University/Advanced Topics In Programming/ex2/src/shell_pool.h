@@ -0,0 +1,88 @@
+/**
+ * @file shell_pool.h
+ * @brief A file depicting the ShellPool class declaration.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "direction.h"
+
+/** All the shells on the board, stored as a structure of arrays: the i-th shell is made of the i-th
+ * position, direction and state. A shell flies one cell per move in its direction, except on its very
+ * first move, on which it stays where it was fired, so its whole flight follows from its position and
+ * direction alone. The arrays keep their capacity as shells come and go, so firing does not allocate once
+ * the pool has grown to the largest number of shells in flight. */
+class ShellPool {
+    private:
+        /* The bits of a shell's state. */
+        static constexpr std::uint8_t EXPLODED = 1 << 0;
+        static constexpr std::uint8_t FRESH = 1 << 1;      /* Fired, but has not made its first move yet. */
+
+        std::vector<std::pair<int, int>> positions_;
+        std::vector<Direction> directions_;
+        std::vector<std::uint8_t> states_;
+
+    public:
+        /* -------------------------------------- CONSTRUCTORS: -------------------------------------- */
+
+        /** Default constructor. */
+        ShellPool() = default;
+        /** Default Copy Constructor. */
+        ShellPool(const ShellPool& shell_pool) = default;
+        /** Default Move Constructor. */
+        ShellPool(ShellPool&& shell_pool) noexcept = default;
+        /** Default Deconstructor. */
+        ~ShellPool() = default;
+
+        /* ---------------------------------------- OPERATORS: --------------------------------------- */
+
+        /** Default Assignment Operator. */
+        ShellPool& operator=(const ShellPool& shell_pool) = default;
+        /** Default Move Assignment Operator. */
+        ShellPool& operator=(ShellPool&& shell_pool) noexcept = default;
+        /** Default Equality Operator. */
+        bool operator==(const ShellPool& shell_pool) const;
+        /** Default Inequality Operator. */
+        bool operator!=(const ShellPool& shell_pool) const;
+
+        /* ----------------------------------------- GETTERS: ---------------------------------------- */
+
+        /** Gets the number of shells in the pool. */
+        size_t size() const;
+        /** Checks if there are no shells in the pool. */
+        bool empty() const;
+        /** Gets the i-th shell's (X, Y) coordinates. */
+        std::pair<int, int> getPos(size_t i) const;
+        /** Gets the i-th shell's direction. */
+        Direction getDir(size_t i) const;
+        /** Checks if the i-th shell has exploded. */
+        bool hasExploded(size_t i) const;
+        /** Checks if the i-th shell was fired, but has not made its first move yet. */
+        bool isFresh(size_t i) const;
+
+        /* ----------------------------------------- SETTERS: ---------------------------------------- */
+
+        /** Sets the i-th shell's explosion status to the given one. */
+        void setExploded(size_t i, bool exploded);
+        /** Sets whether the i-th shell has yet to make its first move to the given one. */
+        void setFresh(size_t i, bool fresh);
+
+        /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
+
+        /** Adds a new shell, fired at the given (X, Y) coordinates in the given direction. */
+        void addShell(std::pair<int, int> pos, Direction dir);
+        /** Moves the i-th shell one step along its flight on a board of the given dimensions, and returns
+         * its new (X, Y) coordinates. */
+        std::pair<int, int> moveShell(size_t i, int rows, int columns);
+        /** Removes the i-th shell in O(1) by moving the last shell into its place. */
+        void swapAndPop(size_t i);
+        /** Removes all the exploded shells in a single pass, keeping the rest in the order they were fired.
+         * The board resolves collisions shell by shell, so it relies on that order staying put. */
+        void removeExploded();
+        /** Removes all the shells, but keeps the pool's capacity. */
+        void clear();
+        /** Resets the ShellPool-type object, releasing its memory. */
+        void resetShellPool() noexcept;
+};
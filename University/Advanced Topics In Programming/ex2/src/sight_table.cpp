@@ -0,0 +1,110 @@
+/**
+ * @file sight_table.cpp
+ * @brief A file detailing the implementation of all the functions declared in sight_table.h.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#include "sight_table.h"
+#include <algorithm>
+using namespace std;
+
+/* ------------------------------------------ CONSTRUCTORS: ------------------------------------------ */
+
+SightTable::SightTable() {
+    rows_ = 0;
+    columns_ = 0;
+    for (int& length : cycleLength_) { length = 0; }
+}
+
+SightTable::SightTable(const vector<vector<char>>& grid) {
+    rows_ = grid.size();
+    columns_ = grid.empty() ? 0 : grid[0].size();
+    for (int axis = 0; axis < 4; axis++) { buildAxis(axis, grid); }
+}
+
+/* --------------------------------------------- GETTERS: -------------------------------------------- */
+
+int SightTable::getRows() const {
+    return rows_;
+}
+
+int SightTable::getColumns() const {
+    return columns_;
+}
+
+int SightTable::getWallDis(pair<int, int> pos, Direction dir) const {
+    return wallDis_[directionToIndex(dir)][pos.first * columns_ + pos.second];
+}
+
+/* ----------------------------------------- OTHER FUNCTIONS: ---------------------------------------- */
+
+void SightTable::buildAxis(int axis, const vector<vector<char>>& grid) {
+    size_t cells = static_cast<size_t>(rows_) * columns_;
+    Direction forward = indexToDirection(axis);
+    vector<int>& cycle = cycle_[axis];
+    vector<int>& place = place_[axis];
+    vector<int>& forwardDis = wallDis_[axis];
+    vector<int>& backwardDis = wallDis_[axis + 4];
+    cycle.assign(cells, -1);
+    place.assign(cells, 0);
+    forwardDis.assign(cells, NO_WALL);
+    backwardDis.assign(cells, NO_WALL);
+    cycleLength_[axis] = 0;
+
+    vector<int> members;
+    int cycles = 0;
+    for (size_t start = 0; start < cells; start++) {
+        if (cycle[start] != -1) { continue; }
+        members.clear();
+        pair<int, int> pos = {start / columns_, start % columns_};
+        int index = start;
+        do {
+            cycle[index] = cycles;
+            place[index] = members.size();
+            members.push_back(index);
+            pos = getNextCoordsInDir(forward, pos, rows_, columns_);
+            index = pos.first * columns_ + pos.second;
+        } while (index != static_cast<int>(start));
+        cycles++;
+
+        /* Every cycle of an axis is equally long, and its walls are found by sweeping it twice, once each
+         * way, so that the sweep has wrapped around by the time it reaches every cell a second time. */
+        int length = members.size();
+        cycleLength_[axis] = length;
+        auto isWall = [&](int i) {
+            int member = members[i % length];
+            return grid[member / columns_][member % columns_] == '#';
+        };
+        int dis = NO_WALL;
+        for (int i = 2 * length - 1; i >= 0; i--) {
+            if (i < length) { forwardDis[members[i]] = dis; }
+            if (isWall(i)) { dis = 0; }
+            if (dis != NO_WALL) { dis++; }
+        }
+        dis = NO_WALL;
+        for (int i = 0; i < 2 * length; i++) {
+            if (i >= length) { backwardDis[members[i - length]] = dis; }
+            if (isWall(i)) { dis = 0; }
+            if (dis != NO_WALL) { dis++; }
+        }
+    }
+}
+
+int SightTable::stepsTo(pair<int, int> pos, Direction dir, pair<int, int> target_pos) const {
+    int dir_idx = directionToIndex(dir);
+    int axis = dir_idx % 4;
+    int from = pos.first * columns_ + pos.second;
+    int to = target_pos.first * columns_ + target_pos.second;
+    if (cycle_[axis][from] != cycle_[axis][to]) { return -1; }
+    int length = cycleLength_[axis];
+    int steps = (dir_idx < 4) ? place_[axis][to] - place_[axis][from] : place_[axis][from] - place_[axis][to];
+    steps = (steps + length) % length;
+    return (steps == 0) ? length : steps;
+}
+
+bool SightTable::hasLineOfSight(pair<int, int> pos, Direction dir, pair<int, int> target_pos) const {
+    int steps = stepsTo(pos, dir, target_pos);
+    if (steps == -1 || steps > max(rows_, columns_)) { return false; }
+    int wall_dis = getWallDis(pos, dir);
+    return wall_dis == NO_WALL || steps <= wall_dis;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file sight_table.h
+ * @brief A file depicting the SightTable class declaration.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#pragma once
+#include <vector>
+#include "direction.h"
+
+/** Precomputed lines of sight over the walls ('#') of a toroidal grid. Stepping in any one direction from
+ * any cell eventually wraps around back to it, so the cells split into cycles per direction. The table
+ * keeps every cell's cycle and place along it for each of the 4 axes (vertical, horizontal and both
+ * diagonals), and its distance to the next wall in each of the 8 directions, making every hasLineOfSight()
+ * query O(1) instead of a walk across the board. As only walls block the sight, a table can be kept for as
+ * long as the grid's walls stay the same. */
+class SightTable {
+    private:
+        int rows_;
+        int columns_;
+        /* Per axis (the direction index modulo 4, stepping in the direction of index < 4), and then per
+         * cell in row-major order: */
+        std::vector<int> cycle_[4];
+        std::vector<int> place_[4];
+        int cycleLength_[4];
+        /* Per direction index, and then per cell: the number of steps to the first wall, or
+         * NO_WALL if there is none on its cycle. */
+        std::vector<int> wallDis_[8];
+
+        /** Fills the tables of the given axis, walking its cycles in the direction of the given index. */
+        void buildAxis(int axis, const std::vector<std::vector<char>>& grid);
+
+    public:
+        /** The distance to the next wall on a wall-less cycle. */
+        static constexpr int NO_WALL = -1;
+
+        /* -------------------------------------- CONSTRUCTORS: -------------------------------------- */
+
+        /** Default Constructor. */
+        SightTable();
+        /** Builds the table of the given grid's walls. */
+        explicit SightTable(const std::vector<std::vector<char>>& grid);
+
+        /* ----------------------------------------- GETTERS: ---------------------------------------- */
+
+        /** Gets the number of rows in the table. */
+        int getRows() const;
+        /** Gets the number of columns in the table. */
+        int getColumns() const;
+        /** Gets the number of steps from the given (X, Y) coordinates in the given direction to the first
+         * wall (which may be at the coordinates themselves, a full cycle away), or NO_WALL if there is
+         * none that way. */
+        int getWallDis(std::pair<int, int> pos, Direction dir) const;
+
+        /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
+
+        /** Gets the number of steps (at least 1) from the given (X, Y) coordinates in the given direction
+         * to the given target coordinates, or -1 if that way never reaches them. */
+        int stepsTo(std::pair<int, int> pos, Direction dir, std::pair<int, int> target_pos) const;
+        /** Checks if walking from the given (X, Y) coordinates in the given direction reaches the given
+         * target coordinates within max(rows, columns) steps, before any wall. */
+        bool hasLineOfSight(std::pair<int, int> pos, Direction dir, std::pair<int, int> target_pos) const;
+};
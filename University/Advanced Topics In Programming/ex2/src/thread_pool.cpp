@@ -0,0 +1,82 @@
+/**
+ * @file thread_pool.cpp
+ * @brief A file detailing the implementation of all the functions declared in thread_pool.h.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#include "thread_pool.h"
+using namespace std;
+
+/* ------------------------------------------ CONSTRUCTORS: ------------------------------------------ */
+
+ThreadPool::ThreadPool(int threads)
+    : task_(nullptr), count_(0), next_(0), busyWorkers_(0), batch_(0), stopping_(false) {
+    for (int i = 1; i < threads; ++i) { workers_.emplace_back(&ThreadPool::workerLoop, this); }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (thread& worker : workers_) { worker.join(); }
+}
+
+/* --------------------------------------------- GETTERS: -------------------------------------------- */
+
+int ThreadPool::getThreads() const {
+    return workers_.size() + 1;
+}
+
+/* ----------------------------------------- OTHER FUNCTIONS: ---------------------------------------- */
+
+void ThreadPool::runTasks() {
+    for (size_t i = next_++; i < count_; i = next_++) {
+        try {
+            (*task_)(i);
+        } catch (...) {
+            lock_guard<mutex> lock(mutex_);
+            if (!error_) { error_ = current_exception(); }
+        }
+    }
+}
+
+void ThreadPool::workerLoop() {
+    unsigned long long seen_batch = 0;
+    while (true) {
+        {
+            unique_lock<mutex> lock(mutex_);
+            wake_.wait(lock, [&]() { return stopping_ || batch_ != seen_batch; });
+            if (stopping_) { return; }
+            seen_batch = batch_;
+        }
+        runTasks();
+        {
+            lock_guard<mutex> lock(mutex_);
+            if (--busyWorkers_ == 0) { done_.notify_one(); }
+        }
+    }
+}
+
+void ThreadPool::parallelFor(size_t count, const function<void(size_t)>& task) {
+    {
+        lock_guard<mutex> lock(mutex_);
+        task_ = &task;
+        count_ = count;
+        next_ = 0;
+        busyWorkers_ = workers_.size();
+        batch_++;
+    }
+    wake_.notify_all();
+    runTasks();
+
+    exception_ptr error;
+    {
+        unique_lock<mutex> lock(mutex_);
+        done_.wait(lock, [&]() { return busyWorkers_ == 0; });
+        task_ = nullptr;
+        swap(error, error_);
+    }
+    if (error) { rethrow_exception(error); }
+}
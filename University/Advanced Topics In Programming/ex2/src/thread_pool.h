@@ -0,0 +1,64 @@
+/**
+ * @file thread_pool.h
+ * @brief A file depicting the ThreadPool class declaration.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** A fixed set of worker threads running batches of independent tasks. The workers are started once and
+ * sleep between batches, so a batch can be handed out every round without starting any threads. */
+class ThreadPool {
+    private:
+        std::vector<std::thread> workers_;
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        std::condition_variable done_;
+        /* The current batch: its task, its number of indices and the next index to hand out. */
+        const std::function<void(size_t)>* task_;
+        size_t count_;
+        std::atomic<size_t> next_;
+        size_t busyWorkers_;
+        unsigned long long batch_;
+        bool stopping_;
+        std::exception_ptr error_;
+
+        /** Runs the current batch's tasks until none is left to hand out. */
+        void runTasks();
+        /** The loop of every worker thread: waits for a batch, and helps running it. */
+        void workerLoop();
+
+    public:
+        /* -------------------------------------- CONSTRUCTORS: -------------------------------------- */
+
+        /** Constructor running batches on the given number of threads, the calling thread included. */
+        explicit ThreadPool(int threads);
+        /** Deleted Copy Constructor, as the workers can only be joined once. */
+        ThreadPool(const ThreadPool& thread_pool) = delete;
+        /** Stops and joins all the workers. */
+        ~ThreadPool();
+
+        /* ---------------------------------------- OPERATORS: --------------------------------------- */
+
+        /** Deleted Assignment Operator, as the workers can only be joined once. */
+        ThreadPool& operator=(const ThreadPool& thread_pool) = delete;
+
+        /* ----------------------------------------- GETTERS: ---------------------------------------- */
+
+        /** Gets the number of threads running every batch, the calling thread included. */
+        int getThreads() const;
+
+        /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
+
+        /** Runs the given task on every index in [0, count), spread over all the threads in no particular
+         * order, and returns once all of them are done. If any of them throws, the first exception is
+         * rethrown here, after the rest are done. */
+        void parallelFor(size_t count, const std::function<void(size_t)>& task);
+};
@@ -0,0 +1,67 @@
+/**
+ * @file threat_map.cpp
+ * @brief A file detailing the implementation of all the functions declared in threat_map.h.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#include "threat_map.h"
+#include <algorithm>
+using namespace std;
+
+/* ------------------------------------------ CONSTRUCTORS: ------------------------------------------ */
+
+ThreatMap::ThreatMap() {
+    rows_ = 0;
+    columns_ = 0;
+    range_ = 0;
+    threatDis_ = vector<int>();
+}
+
+ThreatMap::ThreatMap(const vector<vector<char>>& grid, int range) {
+    rows_ = grid.size();
+    columns_ = grid.empty() ? 0 : grid[0].size();
+    range_ = range;
+    threatDis_.assign(static_cast<size_t>(rows_) * columns_, -1);
+
+    for (int row = 0; row < rows_; row++) {
+        const vector<char>& line = grid[row];
+        for (auto it = find(line.begin(), line.end(), '*'); it != line.end(); it = find(it + 1, line.end(), '*')) {
+            int col = it - line.begin();
+            threatDis_[row * columns_ + col] = 0;
+            for (int dir_idx = 0; dir_idx < 8; dir_idx++) {
+                pair<int, int> pos = {row, col};
+                for (int step = 1; step <= range_; step++) {
+                    pos = getNextCoordsInDir(indexToDirection(dir_idx), pos, rows_, columns_);
+                    int& dis = threatDis_[pos.first * columns_ + pos.second];
+                    if (dis == -1 || step < dis) { dis = step; }
+                }
+            }
+        }
+    }
+}
+
+/* --------------------------------------------- GETTERS: -------------------------------------------- */
+
+int ThreatMap::getRows() const {
+    return rows_;
+}
+
+int ThreatMap::getColumns() const {
+    return columns_;
+}
+
+int ThreatMap::getRange() const {
+    return range_;
+}
+
+int ThreatMap::getThreatDis(pair<int, int> pos) const {
+    if (pos.first < 0 || pos.first >= rows_ || pos.second < 0 || pos.second >= columns_) { return -1; }
+    return threatDis_[pos.first * columns_ + pos.second];
+}
+
+/* ----------------------------------------- OTHER FUNCTIONS: ---------------------------------------- */
+
+bool ThreatMap::threatened(pair<int, int> pos, int steps) const {
+    int dis = getThreatDis(pos);
+    return dis != -1 && dis <= steps;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file threat_map.h
+ * @brief A file depicting the ThreatMap class declaration.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#pragma once
+#include <vector>
+#include "direction.h"
+
+/** The cells of a toroidal grid that the shells on it ('*') may reach soon. A grid does not tell which
+ * way a shell flies, so each one is conservatively taken to fly in any of the 8 directions, and every cell
+ * keeps the fewest steps in which any shell could reach it, up to a given range. The map is built once per
+ * grid, in O(shells * 8 * range), after which every safety check is a single lookup, whatever its range. */
+class ThreatMap {
+    private:
+        int rows_;
+        int columns_;
+        int range_;
+        std::vector<int> threatDis_;
+
+    public:
+        /** The number of steps ahead BaseTankAlgorithm::isSafe() looks, and the default range. */
+        static constexpr int SAFETY_RANGE = 2;
+
+        /* -------------------------------------- CONSTRUCTORS: -------------------------------------- */
+
+        /** Default Constructor. */
+        ThreatMap();
+        /** Builds the threat map of the shells on the given grid, up to the given number of steps. */
+        explicit ThreatMap(const std::vector<std::vector<char>>& grid, int range = SAFETY_RANGE);
+
+        /* ----------------------------------------- GETTERS: ---------------------------------------- */
+
+        /** Gets the number of rows in the map. */
+        int getRows() const;
+        /** Gets the number of columns in the map. */
+        int getColumns() const;
+        /** Gets the number of steps up to which the shells' reach was marked. */
+        int getRange() const;
+        /** Gets the fewest steps in which a shell could reach the given (X, Y) coordinates (0 if one is
+         * already there), or -1 if none could within the map's range. */
+        int getThreatDis(std::pair<int, int> pos) const;
+
+        /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
+
+        /** Checks if a shell is at the given (X, Y) coordinates, or could reach them within the given
+         * number of steps (which should not exceed the map's range). */
+        bool threatened(std::pair<int, int> pos, int steps) const;
+};
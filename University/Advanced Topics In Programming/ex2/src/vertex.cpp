@@ -10,8 +10,6 @@ using namespace std;
 /* ------------------------------------------ CONSTRUCTORS: ------------------------------------------ */
 
 Vertex::Vertex() {
-    adj_ = vector<pair<int, int>>();
-    adj_.reserve(8);
     X_ = 0;
     Y_ = 0;
     HP_ = 0;
@@ -19,8 +17,7 @@ Vertex::Vertex() {
     isMine_ = false;
 }
 
-Vertex::Vertex(const vector<pair<int, int>>& adj, int X, int Y, int HP, bool is_wall, bool is_mine) {
-    adj_ = adj;
+Vertex::Vertex(int X, int Y, int HP, bool is_wall, bool is_mine) {
     X_ = X;
     Y_ = Y;
     HP_ = HP;
@@ -29,7 +26,6 @@ Vertex::Vertex(const vector<pair<int, int>>& adj, int X, int Y, int HP, bool is_
 }
 
 Vertex::Vertex(const Vertex& vertex) {
-    adj_ = vertex.getAdj();
     X_ = vertex.getX();
     Y_ = vertex.getY();
     HP_ = vertex.getHP();
@@ -38,7 +34,6 @@ Vertex::Vertex(const Vertex& vertex) {
 }
 
 Vertex::Vertex(Vertex&& vertex) noexcept {
-    adj_ = move(vertex.adj_);
     X_ = vertex.X_;
     Y_ = vertex.Y_;
     HP_ = vertex.HP_;
@@ -51,7 +46,6 @@ Vertex::Vertex(Vertex&& vertex) noexcept {
 
 Vertex& Vertex::operator=(const Vertex& vertex) {
     if (this != &vertex) {
-        adj_ = vertex.getAdj();
         X_ = vertex.getX();
         Y_ = vertex.getY();
         HP_ = vertex.getHP();
@@ -63,7 +57,6 @@ Vertex& Vertex::operator=(const Vertex& vertex) {
 
 Vertex& Vertex::operator=(Vertex&& vertex) noexcept {
     if (this != &vertex) {
-        adj_ = move(vertex.adj_);
         X_ = vertex.getX();
         Y_ = vertex.getY();
         HP_ = vertex.getHP();
@@ -75,7 +68,7 @@ Vertex& Vertex::operator=(Vertex&& vertex) noexcept {
 }
 
 bool Vertex::operator==(const Vertex& vertex) const {
-    return (adj_ == vertex.getAdj() && X_ == vertex.getX() && Y_ == vertex.getY() &&
+    return (X_ == vertex.getX() && Y_ == vertex.getY() &&
             HP_ == vertex.getHP() && isWall_ == vertex.isWall() && isMine_ == vertex.isMine());
 }
 
@@ -85,10 +78,6 @@ bool Vertex::operator!=(const Vertex& vertex) const {
 
 /* --------------------------------------------- GETTERS: -------------------------------------------- */
 
-const vector<pair<int, int>>& Vertex::getAdj() const noexcept {
-    return adj_;
-}
-
 int Vertex::getX() const noexcept {
     return X_;
 }
@@ -115,10 +104,6 @@ bool Vertex::isMine() const noexcept {
 
 /* --------------------------------------------- SETTERS: -------------------------------------------- */
 
-void Vertex::setAdj(const vector<pair<int, int>>& adj) {
-    adj_ = adj;
-}
-
 void Vertex::setX(int x) {
     if (x < 0) { throw invalid_argument("A vertex's X coordinate cannot be negative!"); }
     X_ = x;
@@ -147,20 +132,9 @@ void Vertex::setMine(bool is_mine) {
 
 /* ----------------------------------------- OTHER FUNCTIONS: ---------------------------------------- */
 
-void Vertex::addAdjCoords(pair<int, int> coords) {
-    adj_.push_back(coords);
-}
-
-void Vertex::clearAdj() noexcept {
-    vector<pair<int, int>>().swap(adj_);
-}
-
-pair<int, int> Vertex::getAdjCoordInDirection(Direction dir) const {
-    int newVertexInd = directionToIndex(dir);
-    if (adj_.empty() || newVertexInd < 0 || newVertexInd >= static_cast<int>(adj_.size())) {
-        throw out_of_range("Direction index out of range or no adjacent coordinates");
-    }
-    return adj_[newVertexInd];
+pair<int, int> Vertex::getAdjCoordInDirection(Direction dir, int rows, int columns) const {
+    if (rows <= 0 || columns <= 0) { throw out_of_range("Board has no adjacent coordinates"); }
+    return getNextCoordsInDir(dir, {X_, Y_}, rows, columns);
 }
 
 void Vertex::increaseHP() {
@@ -185,7 +159,6 @@ void Vertex::wreckWall() noexcept {
 }
 
 void Vertex::resetVertex() noexcept {
-    adj_.clear();
     X_ = Y_ = HP_ = 0;
     isWall_ = isMine_ = false;
 }
\ No newline at end of file
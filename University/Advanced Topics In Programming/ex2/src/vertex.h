@@ -5,12 +5,10 @@
  */
 
 #pragma once
-#include <vector>
 #include "direction.h"
 
 class Vertex {
     private:
-        std::vector<std::pair<int, int>> adj_;
         int X_;
         int Y_;
         int HP_;
@@ -23,7 +21,7 @@ class Vertex {
         /** Default constructor. */
         Vertex();
         /** Constructor with values for all fields. */
-        Vertex(const std::vector<std::pair<int, int>>& adj, int X, int Y, int HP, bool is_wall, bool is_mine);
+        Vertex(int X, int Y, int HP, bool is_wall, bool is_mine);
         /** Default Copy Constructor. */
         Vertex(const Vertex& vertex);
         /** Default Move Constructor. */
@@ -44,8 +42,6 @@ class Vertex {
 
         /* ----------------------------------------- GETTERS: ---------------------------------------- */
 
-        /** Gets the (X, Y) coordinates of vertices adjacent to this one. */
-        const std::vector<std::pair<int, int>>& getAdj() const noexcept;
         /** Gets the vertex's X coordinate. */
         int getX() const noexcept;
         /** Gets the vertex's Y coordinate. */
@@ -61,9 +57,6 @@ class Vertex {
 
         /* ----------------------------------------- SETTERS: ---------------------------------------- */
 
-        /** Sets the vector of (X, Y) coordinates of this vertex's of adjacent vertices to the given
-         * one. */
-        void setAdj(const std::vector<std::pair<int, int>>& adj);
         /** Sets the vertex's X coordinate to the given integer. Must be non-negative. */
         void setX(int x);
         /** Sets the vertex's Y coordinate to the given integer. Must be non-negative. */
@@ -78,13 +71,9 @@ class Vertex {
 
         /* ------------------------------------- OTHER FUNCTIONS: ------------------------------------ */
 
-        /** Adds the (X, Y) coordinates of a new vertex to the vector of (X, Y) coordinates of this
-         * vertex's vector of adjacent vertices */
-        void addAdjCoords(std::pair<int, int> coords);
-        /** Clears all memory allocated for the vertex's adj_ field. */
-        void clearAdj() noexcept;
-        /** Gets the (X, Y) coordinates of this vertex's adjacent vertex in the specified direction */
-        std::pair<int, int> getAdjCoordInDirection(Direction dir) const;
+        /** Gets the (X, Y) coordinates of this vertex's adjacent vertex in the specified direction, on a
+         * board with the given number of rows and columns. */
+        std::pair<int, int> getAdjCoordInDirection(Direction dir, int rows, int columns) const;
         /** Increases the wall's remaining HP by 1. */
         void increaseHP();
         /** Decreases the wall's remaining HP by 1. */
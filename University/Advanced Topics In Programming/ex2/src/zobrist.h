@@ -0,0 +1,54 @@
+/**
+ * @file zobrist.h
+ * @brief A file depicting the keys the board's state hash is made of.
+ * The maximal number of columns in a comment-line in this file is 106.
+ */
+
+#pragma once
+#include <cstdint>
+#include "cell.h"
+#include "direction.h"
+#include "tank.h"
+
+/** Zobrist-style hashing: the hash of a state is the XOR of a key per element of it (a cell's contents, a
+ * shell, a tank), so that changing one element updates the hash by XORing its old key out and its new key
+ * in. Rather than being drawn into tables (which would take 256 keys per cell), every key is a strong mix
+ * of the element's value, which is just as random for telling states apart. Empty cells and dead tanks
+ * have no key, so a fresh board hashes to 0. */
+namespace Zobrist {
+    /* Distinct salts, so that equal values of different kinds of elements get unrelated keys. */
+    constexpr std::uint64_t CELL_SALT = 0x243f6a8885a308d3ULL;
+    constexpr std::uint64_t SHELL_SALT = 0x13198a2e03707344ULL;
+    constexpr std::uint64_t TANK_SALT = 0xa4093822299f31d0ULL;
+    constexpr std::uint64_t ROUND_SALT = 0x082efa98ec4e6c89ULL;
+
+    /** The splitmix64 finalizer: every bit of the result depends on every bit of the given value. */
+    constexpr std::uint64_t mix(std::uint64_t value) {
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+        return value ^ (value >> 31);
+    }
+
+    /** Gets the key of the given contents of the cell at the given index. */
+    inline std::uint64_t cellKey(int index, Cell cell) {
+        if (cell == CellFlag::EMPTY) { return 0; }
+        return mix(CELL_SALT ^ (static_cast<std::uint64_t>(index) << 8 | cell));
+    }
+
+    /** Gets the key of a shell at the given cell index, flying in the given direction. */
+    inline std::uint64_t shellKey(int index, Direction dir, bool fresh) {
+        return mix(SHELL_SALT ^ (static_cast<std::uint64_t>(index) << 4 | directionToIndex(dir) << 1 | fresh));
+    }
+
+    /** Gets the key of the tank at the given index, as made of everything its next moves depend on. */
+    inline std::uint64_t tankKey(int tank_ind, const Tank& tank) {
+        if (!tank.alive()) { return 0; }
+        std::uint64_t pos = static_cast<std::uint64_t>(static_cast<std::uint32_t>(tank.getPos().first)) << 32 |
+            static_cast<std::uint32_t>(tank.getPos().second);
+        std::uint64_t counters = static_cast<std::uint64_t>(static_cast<std::uint32_t>(tank.getAmmo())) << 32 |
+            static_cast<std::uint64_t>(static_cast<std::uint8_t>(tank.getBackCnt())) << 16 |
+            static_cast<std::uint64_t>(static_cast<std::uint8_t>(tank.getLastShotCnt())) << 8 |
+            directionToIndex(tank.getDir());
+        return mix(mix(mix(TANK_SALT ^ static_cast<std::uint64_t>(tank_ind)) ^ pos) ^ counters);
+    }
+}
@@ -0,0 +1,172 @@
+/**
+ * @file tournament.cpp
+ * @brief A driver running many games concurrently and reporting their aggregated results.
+ * The maximal number of columns in a comment-line in this file is 106.
+ *
+ * Usage: tournament [-j threads] [-r repetitions] {directory or input files...}
+ * A directory stands for all the input_*.txt files in it. Every game runs headless on a pool of worker
+ * threads, each with its own GameManager and factories, and writes its own output file into the current
+ * directory, exactly as tanks_game would. Only its input errors go elsewhere: into input_errors_X.txt for
+ * input_X.txt, rather than into the input_errors.txt all the games would share. Inputs whose output files
+ * would have the same name (input files of the same name from different directories) are rejected before
+ * any game starts. With -r, a game ends in a tie once the same state has been repeated that many times
+ * (see GameManager::setRepetitionLimit()).
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gamemanager.h"
+#include "MyTankAlgorithmFactory.h"
+#include "MyPlayerFactory.h"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+/** Collects the input files named by the given argument: itself, or all the input_*.txt files in it. */
+static void collectInputFiles(const string& arg, vector<string>& input_files) {
+    if (!fs::is_directory(arg)) {
+        input_files.push_back(arg);
+        return;
+    }
+    vector<string> found;
+    for (const auto& entry : fs::directory_iterator(arg)) {
+        string name = entry.path().filename().string();
+        if (entry.is_regular_file() && name.rfind("input_", 0) == 0 && entry.path().extension() == ".txt") {
+            found.push_back(entry.path().string());
+        }
+    }
+    sort(found.begin(), found.end());
+    input_files.insert(input_files.end(), found.begin(), found.end());
+}
+
+/** Reads the given value of the given option as a whole number no smaller than the given minimum, or
+ * throws an invalid_argument naming the option. */
+static int parseFlagValue(const string& flag, const string& value, int minimum) {
+    size_t parsed = 0;
+    int result = 0;
+    try { result = stoi(value, &parsed); }
+    catch (const exception&) { parsed = 0; }
+    if (parsed == 0 || parsed != value.size() || result < minimum) {
+        throw invalid_argument("Invalid value for " + flag + ": " + value);
+    }
+    return result;
+}
+
+/** Throws if any two of the given input files would write the same output file, as their games would
+ * then append to each other's output. Input files not named input_*.txt are left for their own games to
+ * fail on. */
+static void checkOutputNames(const vector<string>& input_files) {
+    map<string, string> inputs_by_output;
+    for (const string& input_file : input_files) {
+        string output_file;
+        try { output_file = GameManager::getOutputFilename(input_file); }
+        catch (const exception&) { continue; }
+        auto [it, inserted] = inputs_by_output.emplace(output_file, input_file);
+        if (!inserted) {
+            throw invalid_argument(input_file + " and " + it->second + " would both write " + it->first);
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    unsigned threads = max(1u, thread::hardware_concurrency());
+    int repetitions = 0;
+    vector<string> input_files;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            string arg = argv[i];
+            if ((arg == "-j" || arg == "-r") && i + 1 == argc) {
+                throw invalid_argument("Missing value for " + arg);
+            }
+            if (arg == "-j") { threads = parseFlagValue(arg, argv[++i], 1); }
+            else if (arg == "-r") { repetitions = parseFlagValue(arg, argv[++i], 0); }
+            else if (arg.rfind("-", 0) == 0) { throw invalid_argument("Unknown option: " + arg); }
+            else { collectInputFiles(arg, input_files); }
+        }
+        checkOutputNames(input_files);
+    } catch (const exception& e) {
+        cerr << "Error: " << e.what() << endl;
+        return 1;
+    }
+    if (input_files.empty()) {
+        cout << "no input files given!\n";
+        return 1;
+    }
+    threads = min<size_t>(threads, input_files.size());
+
+    /* The tank algorithms' debug printing is shared by all of them, so it is turned off once, before any
+     * game starts. */
+    BaseTankAlgorithm::setDebugOutput(false);
+
+    atomic<size_t> next_game = 0;
+    atomic<int> wins[3] = {0, 0, 0};    /* Indexed by GameManager::getWinner(): ties, then players 1, 2. */
+    atomic<int> unfinished = 0;
+    atomic<long long> load_ns = 0;    /* Summed over all games, so they can exceed the wall-clock time. */
+    atomic<long long> play_ns = 0;
+    mutex errors_mutex;
+    vector<string> errors;
+
+    auto worker = [&]() {
+        for (size_t game_ind = next_game++; game_ind < input_files.size(); game_ind = next_game++) {
+            try {
+                GameManager game(make_unique<MyPlayerFactory>(), make_unique<MyTankAlgorithmFactory>());
+                game.setConsoleOutput(false);
+                game.setRepetitionLimit(repetitions);
+                string output_file = GameManager::getOutputFilename(input_files[game_ind]);
+                game.setErrorFileName("input_errors_" + output_file.substr(string("output_").size()));
+                auto start = chrono::steady_clock::now();
+                game.readBoard(input_files[game_ind]);
+                auto loaded = chrono::steady_clock::now();
+                game.run();
+                auto done = chrono::steady_clock::now();
+                load_ns += chrono::duration_cast<chrono::nanoseconds>(loaded - start).count();
+                play_ns += chrono::duration_cast<chrono::nanoseconds>(done - loaded).count();
+                int winner = game.getWinner();
+                if (winner >= 0) { wins[winner]++; }
+                else { unfinished++; }
+            } catch (const exception& e) {
+                lock_guard<mutex> lock(errors_mutex);
+                errors.push_back(input_files[game_ind] + ": " + e.what());
+            }
+        }
+    };
+
+    auto start = chrono::steady_clock::now();
+    vector<thread> pool;
+    for (unsigned i = 0; i < threads; ++i) { pool.emplace_back(worker); }
+    for (thread& t : pool) { t.join(); }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    for (const string& error : errors) { cerr << "Error: " << error << '\n'; }
+    size_t games = input_files.size() - errors.size();
+    auto percent = [games](int count) { return games == 0 ? 0.0 : 100.0 * count / games; };
+    cout << games << " games on " << threads << " threads in " << elapsed.count() << " s ("
+         << games / elapsed.count() << " games/s)\n"
+         << "Player 1 won: " << wins[1] << " (" << percent(wins[1]) << "%)\n"
+         << "Player 2 won: " << wins[2] << " (" << percent(wins[2]) << "%)\n"
+         << "Ties:         " << wins[0] << " (" << percent(wins[0]) << "%)\n"
+         << "Loading took " << load_ns / 1e9 << " s and playing " << play_ns / 1e9
+         << " s, summed over all games\n";
+    unsigned long path_hits = BaseTankAlgorithm::getTotalPathCacheHits();
+    unsigned long path_lookups = path_hits + BaseTankAlgorithm::getTotalPathCacheMisses();
+    unsigned long field_lookups = BasePlayer::getTotalDistanceFieldLookups();
+    unsigned long field_reuses = field_lookups - BasePlayer::getTotalDistanceFieldBuilds();
+    auto rate = [](unsigned long count, unsigned long total) {
+        return total == 0 ? 0.0 : 100.0 * count / total;
+    };
+    cout << "Paths reused " << path_hits << " of " << path_lookups << " times ("
+         << rate(path_hits, path_lookups) << "%), distance fields " << field_reuses << " of "
+         << field_lookups << " times (" << rate(field_reuses, field_lookups) << "%)\n";
+    if (unfinished > 0) { cout << "Unfinished:   " << unfinished << '\n'; }
+    if (!errors.empty()) { cout << "Failed:       " << errors.size() << '\n'; }
+    return errors.empty() ? 0 : 1;
+}